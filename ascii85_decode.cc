@@ -1,81 +1,235 @@
 #include <string>
-#include <vector>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <cstdint>
 
 #include "common.h"
+#include "filter_chain.h"
+#include "simd.h"
 
 using namespace std;
 
 namespace
 {
-    const vector<unsigned long> powers85{85*85*85*85, 85*85*85, 85*85, 85, 1};
+    enum { GROUP_SIZE = 5, MAX_DIGIT = 'u' - '!', PADDING_DIGIT = MAX_DIGIT };
+    const uint32_t powers85[GROUP_SIZE] = {85*85*85*85, 85*85*85, 85*85, 85, 1};
 
-    string wide_put(unsigned long tuple, int bytes)
+    //kernel decodes groups of 5 digits without 'z' and white-spaces, it returns number of decoded characters.
+    //Values of groups are taken modulo 2^32
+    typedef size_t (*ascii85_kernel_t)(const char *data, size_t len, char *out);
+
+    void put_tuple(uint32_t tuple, int bytes, char *out)
+    {
+        for (int i = 0; i < bytes; ++i) out[i] = static_cast<char>(tuple >> (24 - 8 * i));
+    }
+
+    bool is_group(const char *data)
     {
-        char data[4];
-        
-        switch (bytes) 
+        for (int i = 0; i < GROUP_SIZE; ++i)
         {
-        case 4:
-            data[0] = static_cast<char>(tuple >> 24);
-            data[1] = static_cast<char>(tuple >> 16);
-            data[2] = static_cast<char>(tuple >>  8);
-            data[3] = static_cast<char>(tuple);
-            break;
-        case 3:
-            data[0] = static_cast<char>(tuple >> 24);
-            data[1] = static_cast<char>(tuple >> 16);
-            data[2] = static_cast<char>(tuple >>  8);
-            break;
-        case 2:
-            data[0] = static_cast<char>(tuple >> 24);
-            data[1] = static_cast<char>(tuple >> 16);
-            break;
-        case 1:
-            data[0] = static_cast<char>(tuple >> 24);
-            break;
+            if (static_cast<unsigned char>(data[i] - '!') > MAX_DIGIT) return false;
         }
-        return string(data, bytes);
+        return true;
     }
-}
 
-string ascii85_decode(const string &buf, const dict_t &opts)
-{
-    int count = 0;
-    unsigned long tuple = 0;
-    bool found_end_marker = false;
-    const char* buffer = buf.data();
-    size_t len = buf.length();
-    string result;
-    while (len && !found_end_marker)
+    size_t ascii85_kernel_scalar(const char *data, size_t len, char *out)
     {
-        switch (*buffer)
+        size_t i = 0;
+        for (; i + GROUP_SIZE <= len && is_group(data + i); i += GROUP_SIZE, out += 4)
         {
-        default:
-            if (*buffer < '!' || *buffer > 'u') throw pdf_error(FUNC_STRING + "*buffer is out of range");
-            tuple += (*buffer - '!') * powers85.at(count++);
-            if (count == 5)
+            uint32_t tuple = 0;
+            for (int j = 0; j < GROUP_SIZE; ++j) tuple = tuple * 85 + (data[i + j] - '!');
+            put_tuple(tuple, 4, out);
+        }
+        return i;
+    }
+
+#ifdef PDF_EXTRACTOR_X86_SIMD
+    //8 groups per step: digit j of every group is gathered to 32 bit lanes
+    TARGET_AVX2 size_t ascii85_kernel_avx2(const char *data, size_t len, char *out)
+    {
+        enum { GROUPS_NUM = 8, STEP = GROUPS_NUM * GROUP_SIZE, GATHER_OVERREAD = 3 };
+        const __m256i offsets = _mm256_setr_epi32(0, 5, 10, 15, 20, 25, 30, 35);
+        const __m256i byte_mask = _mm256_set1_epi32(0xFF);
+        const __m256i bswap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                               3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+        size_t i = 0;
+        for (; i + STEP + GATHER_OVERREAD <= len; i += STEP)
+        {
+            const int *base = reinterpret_cast<const int*>(data + i);
+            __m256i tuple = _mm256_setzero_si256();
+            __m256i invalid = _mm256_setzero_si256();
+            for (int j = 0; j < GROUP_SIZE; ++j)
             {
-                result += wide_put(tuple, 4);
-                count = 0;
-                tuple = 0;
+                __m256i c = _mm256_and_si256(_mm256_i32gather_epi32(base, _mm256_add_epi32(offsets, _mm256_set1_epi32(j)), 1),
+                                             byte_mask);
+                __m256i digit = _mm256_sub_epi32(c, _mm256_set1_epi32('!'));
+                invalid = _mm256_or_si256(invalid, _mm256_or_si256(_mm256_cmpgt_epi32(digit, _mm256_set1_epi32(MAX_DIGIT)),
+                                                                   _mm256_cmpgt_epi32(_mm256_setzero_si256(), digit)));
+                tuple = _mm256_add_epi32(_mm256_mullo_epi32(tuple, _mm256_set1_epi32(85)), digit);
             }
-            break;
-        case 'z':
-            if (count != 0) throw pdf_error(FUNC_STRING + "count is not zero");
-            result += wide_put(tuple, 4);
-            break;
-        case '~':
-            ++buffer; 
-            --len;
-            if(len && *buffer != '>') throw pdf_error(FUNC_STRING + "buffer is not >");
-            found_end_marker = true;
-            break;
-        case '\n': case '\r': case '\t': case ' ':
-        case '\0': case '\f': case '\b': case 0177:
-            break;
+            if (!_mm256_testz_si256(invalid, invalid)) break;
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i / GROUP_SIZE * 4), _mm256_shuffle_epi8(tuple, bswap));
         }
-        --len;
-        ++buffer;
+        //legacy SSE code after 256 bit instructions is slow until upper halves of registers are cleared
+        _mm256_zeroupper();
+        return i + ascii85_kernel_scalar(data + i, len - i, out + i / GROUP_SIZE * 4);
+    }
+
+    ascii85_kernel_t get_ascii85_kernel()
+    {
+        return cpu_has_avx2()? ascii85_kernel_avx2 : ascii85_kernel_scalar;
     }
+#else
+    ascii85_kernel_t get_ascii85_kernel()
+    {
+        return ascii85_kernel_scalar;
+    }
+#endif
+
+    const ascii85_kernel_t ASCII85_KERNEL = get_ascii85_kernel();
+
+    class ASCII85Decoder
+    {
+    public:
+        ASCII85Decoder() : count(0), tuple(0), found_tilde(false), finished(false)
+        {
+        }
+
+        //appends decoded data to result, data after "~>" is ignored
+        void decode(boost::string_view data, string &result)
+        {
+            size_t end = result.length();
+            size_t i = 0;
+            while (i < data.length() && !finished)
+            {
+                if (count == 0 && !found_tilde)
+                {
+                    reserve(result, end + (data.length() - i) / GROUP_SIZE * 4);
+                    size_t len = ASCII85_KERNEL(data.data() + i, data.length() - i, &result[end]);
+                    i += len;
+                    end += len / GROUP_SIZE * 4;
+                    if (i == data.length()) break;
+                }
+                //white-spaces, 'z', end marker and groups split by them
+                decode_char(data[i++], result, end);
+            }
+            result.resize(end);
+        }
+
+        //final partial group of n characters is padded with 'u' and gives n - 1 bytes
+        void finish(string &result)
+        {
+            if (count > 1)
+            {
+                for (int i = count; i < GROUP_SIZE; ++i) tuple += PADDING_DIGIT * powers85[i];
+                char data[4];
+                put_tuple(tuple, count - 1, data);
+                result.append(data, count - 1);
+            }
+            count = 0;
+            tuple = 0;
+            finished = true;
+        }
+
+        bool is_finished() const
+        {
+            return finished;
+        }
+    private:
+        static void reserve(string &result, size_t len)
+        {
+            if (len > result.length()) result.resize(max(len, result.length() * 2));
+        }
+
+        void decode_char(char c, string &result, size_t &end)
+        {
+            if (found_tilde)
+            {
+                if (c != '>') throw pdf_error(FUNC_STRING + "buffer is not >");
+                result.resize(end);
+                finish(result);
+                end = result.length();
+                return;
+            }
+            switch (c)
+            {
+            default:
+                if (c < '!' || c > 'u') throw pdf_error(FUNC_STRING + "*buffer is out of range");
+                tuple += (c - '!') * powers85[count++];
+                if (count == GROUP_SIZE)
+                {
+                    reserve(result, end + 4);
+                    put_tuple(tuple, 4, &result[end]);
+                    end += 4;
+                    count = 0;
+                    tuple = 0;
+                }
+                break;
+            case 'z':
+                if (count != 0) throw pdf_error(FUNC_STRING + "count is not zero");
+                reserve(result, end + 4);
+                put_tuple(0, 4, &result[end]);
+                end += 4;
+                break;
+            case '~':
+                found_tilde = true;
+                break;
+            case '\n': case '\r': case '\t': case ' ':
+            case '\0': case '\f': case '\b': case 0177:
+                break;
+            }
+        }
+    private:
+        int count;
+        uint32_t tuple;
+        bool found_tilde;
+        bool finished;
+    };
+
+    class ASCII85Stage : public FilterStage
+    {
+    public:
+        explicit ASCII85Stage(unique_ptr<FilterStage> &&source_arg) : source(std::move(source_arg))
+        {
+        }
+
+        boost::string_view read() override
+        {
+            output.clear();
+            while (output.empty() && !decoder.is_finished())
+            {
+                if (input.empty()) input = source->read();
+                if (input.empty())
+                {
+                    decoder.finish(output);
+                    break;
+                }
+                size_t len = min<size_t>(input.length(), FILTER_CHUNK_SIZE);
+                decoder.decode(input.substr(0, len), output);
+                input.remove_prefix(len);
+            }
+            return output;
+        }
+    private:
+        unique_ptr<FilterStage> source;
+        boost::string_view input;
+        ASCII85Decoder decoder;
+        string output;
+    };
+}
+
+string ascii85_decode(const string &buf, const dict_t &opts)
+{
+    ASCII85Decoder decoder;
+    string result;
+    decoder.decode(buf, result);
+    decoder.finish(result);
     return result;
 }
+
+unique_ptr<FilterStage> make_ascii85_stage(unique_ptr<FilterStage> &&source, const dict_t &opts)
+{
+    return unique_ptr<FilterStage>(new ASCII85Stage(std::move(source)));
+}
@@ -1,85 +1,228 @@
 #include <string>
-#include <map>
-#include <set>
+#include <array>
+#include <memory>
+#include <algorithm>
+#include <utility>
 
 #include "common.h"
+#include "filter_chain.h"
+#include "simd.h"
 
 using namespace std;
 
 namespace
 {
-    const set<unsigned int> white_chars{
-        0x00, // NULL
-        0x09, // TAB
-        0x0A, // Line Feed
-        0x0C, // Form Feed
-        0x0D, // Carriage Return
-        0x20, // White Space
-        0x00  // end marker
-    };
+    enum { WHITE_CHAR = 0xFE, INVALID_CHAR = 0xFF };
 
-    const map<unsigned char, unsigned char> hex_map = {{0x30, 0x0},//0-9
-                                                       {0x31, 0x1},
-                                                       {0x32, 0x2},
-                                                       {0x33, 0x3},
-                                                       {0x34, 0x4},
-                                                       {0x35, 0x5},
-                                                       {0x36, 0x6},
-                                                       {0x37, 0x7},
-                                                       {0x38, 0x8},
-                                                       {0x39, 0x9},
-                                                       {0x61, 0xA},//a-f
-                                                       {0x62, 0xB},
-                                                       {0x63, 0xC},
-                                                       {0x64, 0xD},
-                                                       {0x65, 0xE},
-                                                       {0x66, 0xF},
-                                                       {0x41, 0xA},//A-F
-                                                       {0x42, 0xB},
-                                                       {0x43, 0xC},
-                                                       {0x44, 0xD},
-                                                       {0x45, 0xE},
-                                                       {0x46, 0xF}};
-}
+    //hex digit value or WHITE_CHAR for 7.2.2 white-space characters
+    array<unsigned char, 256> make_hex_table()
+    {
+        array<unsigned char, 256> result;
+        result.fill(INVALID_CHAR);
+        for (unsigned char c : {0x00, 0x09, 0x0A, 0x0C, 0x0D, 0x20}) result[c] = WHITE_CHAR;
+        for (unsigned int i = 0; i < 10; ++i) result['0' + i] = i;
+        for (unsigned int i = 0; i < 6; ++i) result['a' + i] = result['A' + i] = 10 + i;
+        return result;
+    }
 
-string ascii_hex_decode(const string &buf, const dict_t &dict)
-{
-    bool low = true;
-    const char *buffer = buf.c_str();
-    size_t len = buf.length();
-    string result;
-    unsigned char decoded_byte = 0;
+    const array<unsigned char, 256> HEX_TABLE = make_hex_table();
 
-    while (len--)
+    //kernel decodes blocks which contain only hex digits, it returns number of decoded characters
+    typedef size_t (*hex_kernel_t)(const char *data, size_t len, char *out);
+
+#ifdef PDF_EXTRACTOR_X86_SIMD
+    //returns nibbles of hex digits and mask of valid digits
+    inline __m128i get_nibbles_sse2(__m128i c, __m128i &valid)
+    {
+        __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+        __m128i lower = _mm_or_si128(c, _mm_set1_epi8(0x20));
+        __m128i is_alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                         _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+        valid = _mm_or_si128(is_digit, is_alpha);
+        return _mm_or_si128(_mm_and_si128(is_digit, _mm_sub_epi8(c, _mm_set1_epi8('0'))),
+                            _mm_andnot_si128(is_digit, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+    }
+
+    size_t hex_kernel_sse2(const char *data, size_t len, char *out)
     {
-        if (*buffer == '>')
+        size_t i = 0;
+        for (; i + 16 <= len; i += 16)
         {
-            if (!low) result.append(1, (decoded_byte << 4) | 0);
-            return result;
+            __m128i valid;
+            __m128i nibbles = get_nibbles_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), valid);
+            if (_mm_movemask_epi8(valid) != 0xFFFF) break;
+            //16 bit lane has high nibble in its low byte and low nibble in its high byte
+            __m128i bytes = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(nibbles, 4), _mm_set1_epi16(0x00F0)),
+                                         _mm_srli_epi16(nibbles, 8));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i / 2), _mm_packus_epi16(bytes, bytes));
+        }
+        return i;
+    }
+
+    TARGET_AVX2 size_t hex_kernel_avx2(const char *data, size_t len, char *out)
+    {
+        size_t i = 0;
+        for (; i + 32 <= len; i += 32)
+        {
+            __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            __m256i is_digit = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('0' - 1)),
+                                                _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), c));
+            __m256i lower = _mm256_or_si256(c, _mm256_set1_epi8(0x20));
+            __m256i is_alpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+                                                _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+            if (static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_alpha))) != 0xFFFFFFFF) break;
+            __m256i nibbles = _mm256_blendv_epi8(_mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10)),
+                                                 _mm256_sub_epi8(c, _mm256_set1_epi8('0')),
+                                                 is_digit);
+            __m256i bytes = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi16(nibbles, 4), _mm256_set1_epi16(0x00F0)),
+                                            _mm256_srli_epi16(nibbles, 8));
+            //packing works inside 128 bit lanes, so results of both lanes are moved to the low half
+            __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(bytes, bytes), 0xD8);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i / 2), _mm256_castsi256_si128(packed));
         }
-        if (white_chars.count(*buffer))
+        //legacy SSE code after 256 bit instructions is slow until upper halves of registers are cleared
+        _mm256_zeroupper();
+        return i + hex_kernel_sse2(data + i, len - i, out + i / 2);
+    }
+
+    hex_kernel_t get_hex_kernel()
+    {
+        return cpu_has_avx2()? hex_kernel_avx2 : hex_kernel_sse2;
+    }
+#else
+    hex_kernel_t get_hex_kernel()
+    {
+        return nullptr;
+    }
+#endif
+
+    const hex_kernel_t HEX_KERNEL = get_hex_kernel();
+
+    class HexDecoder
+    {
+    public:
+        HexDecoder() : decoded_byte(0), low(true), finished(false)
         {
-            ++buffer;
-            continue;
         }
 
-        unsigned char val = hex_map.at(static_cast<unsigned char>(*buffer));
-        if (low)
+        //appends decoded data to result, data after '>' is ignored
+        void decode(boost::string_view data, string &result)
         {
-            decoded_byte = val;
-            low = false;
+            size_t end = result.length();
+            result.resize(end + data.length() / 2 + 1);
+            char *out = &result[0];
+            size_t i = 0;
+            while (i < data.length() && !finished)
+            {
+                if (low && HEX_KERNEL)
+                {
+                    size_t len = HEX_KERNEL(data.data() + i, data.length() - i, out + end);
+                    i += len;
+                    end += len / 2;
+                }
+                //white-space, end marker or tail shorter than kernel block. Kernel is retried from the next even digit
+                if (i < data.length()) decode_char(data[i++], out, end);
+                while (i < data.length() && !low && !finished) decode_char(data[i++], out, end);
+            }
+            result.resize(end);
         }
-        else
+
+        //odd number of digits: last digit is followed by 0
+        void finish(string &result)
         {
-            decoded_byte = ((decoded_byte << 4) | val);
+            if (!low) result.append(1, (decoded_byte << 4) | 0);
             low = true;
-            result.append(1, decoded_byte);
-            decoded_byte = 0;
+            finished = true;
         }
-        ++buffer;
-    }
 
-    if (!low) result.append(1, (decoded_byte << 4) | 0);
+        bool is_finished() const
+        {
+            return finished;
+        }
+    private:
+        void decode_char(char c, char *out, size_t &end)
+        {
+            unsigned char val = HEX_TABLE[static_cast<unsigned char>(c)];
+            if (val == WHITE_CHAR) return;
+            if (c == '>')
+            {
+                if (!low) out[end++] = (decoded_byte << 4) | 0;
+                low = true;
+                finished = true;
+                return;
+            }
+            if (val == INVALID_CHAR) throw pdf_error(FUNC_STRING + "wrong hex char " + to_string(static_cast<unsigned char>(c)));
+            if (low)
+            {
+                decoded_byte = val;
+                low = false;
+            }
+            else
+            {
+                out[end++] = (decoded_byte << 4) | val;
+                low = true;
+            }
+        }
+    private:
+        unsigned char decoded_byte;
+        bool low;
+        bool finished;
+    };
+
+    class HexStage : public FilterStage
+    {
+    public:
+        explicit HexStage(unique_ptr<FilterStage> &&source_arg) : source(std::move(source_arg))
+        {
+        }
+
+        boost::string_view read() override
+        {
+            output.clear();
+            while (output.empty() && !decoder.is_finished())
+            {
+                if (input.empty()) input = source->read();
+                if (input.empty())
+                {
+                    decoder.finish(output);
+                    break;
+                }
+                size_t len = min<size_t>(input.length(), FILTER_CHUNK_SIZE);
+                decoder.decode(input.substr(0, len), output);
+                input.remove_prefix(len);
+            }
+            return output;
+        }
+    private:
+        unique_ptr<FilterStage> source;
+        boost::string_view input;
+        HexDecoder decoder;
+        string output;
+    };
+}
+
+//7.3.4.3 Hexadecimal Strings without enclosing angle brackets
+string hex_decode(boost::string_view hex)
+{
+    HexDecoder decoder;
+    string result;
+    decoder.decode(hex, result);
+    decoder.finish(result);
+
+    return result;
+}
+
+string ascii_hex_decode(const string &buf, const dict_t &dict)
+{
+    HexDecoder decoder;
+    string result;
+    decoder.decode(buf, result);
+    decoder.finish(result);
 
     return result;
 }
+
+unique_ptr<FilterStage> make_ascii_hex_stage(unique_ptr<FilterStage> &&source, const dict_t &opts)
+{
+    return unique_ptr<FilterStage>(new HexStage(std::move(source)));
+}
@@ -0,0 +1,38 @@
+#include <string>
+#include <cstring>
+#include <cstdlib>
+
+#include <benchmark/benchmark.h>
+
+using namespace std;
+
+extern void register_corpus_benchmarks(const string &corpus_dir);
+
+namespace
+{
+    const char CORPUS_OPTION[] = "--corpus=";
+
+    //directory with local pdf files is taken from --corpus=DIR or PDF_EXTRACT_CORPUS environment variable
+    string get_corpus_dir(int &argc, char **argv)
+    {
+        const char *env = getenv("PDF_EXTRACT_CORPUS");
+        string result = env? env : "";
+        int j = 1;
+        for (int i = 1; i < argc; ++i)
+        {
+            if (strncmp(argv[i], CORPUS_OPTION, strlen(CORPUS_OPTION)) == 0) result = argv[i] + strlen(CORPUS_OPTION);
+            else argv[j++] = argv[i];
+        }
+        argc = j;
+        return result;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    register_corpus_benchmarks(get_corpus_dir(argc, argv));
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -0,0 +1,346 @@
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+
+#include <zlib.h>
+
+#include "bench_utils.h"
+#include "common.h"
+
+using namespace std;
+
+extern size_t get_cross_ref_offset(boost::string_view buffer);
+extern vector<pair<size_t, size_t>> get_trailer_offsets(boost::string_view buffer, size_t cross_ref_offset);
+extern xref_t get_xref(boost::string_view buffer, const vector<pair<size_t, size_t>> &trailer_offsets);
+
+namespace
+{
+    enum
+    {
+        LZW_CLEAR = 256,
+        LZW_EOD = 257,
+        LZW_FIRST_CODE = 258,
+        LZW_MAX_CODE = 4094,
+        LZW_MIN_CODE_LEN = 9,
+        LZW_MAX_CODE_LEN = 12
+    };
+
+    class BitWriter
+    {
+    public:
+        BitWriter() : acc(0), bits(0)
+        {
+        }
+
+        void write(unsigned int code, unsigned int len)
+        {
+            acc = (acc << len) | code;
+            bits += len;
+            while (bits >= 8)
+            {
+                bits -= 8;
+                result.push_back(static_cast<char>((acc >> bits) & 0xFF));
+            }
+            acc &= (1u << bits) - 1;
+        }
+
+        string finish()
+        {
+            if (bits) result.push_back(static_cast<char>((acc << (8 - bits)) & 0xFF));
+            return std::move(result);
+        }
+    private:
+        uint32_t acc;
+        unsigned int bits;
+        string result;
+    };
+
+    string xref_line(size_t offset, char status)
+    {
+        char line[21];
+        snprintf(line, sizeof(line), "%010zu 00000 %c\r\n", offset, status);
+        return line;
+    }
+}
+
+string make_document(const vector<string> &objects, size_t root_id)
+{
+    string doc = "%PDF-1.4\n";
+    vector<size_t> offsets;
+    offsets.reserve(objects.size());
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        offsets.push_back(doc.size());
+        doc += to_string(i + 1) + " 0 obj\n" + objects[i] + "\nendobj\n";
+    }
+    size_t xref_offset = doc.size();
+    doc += "xref\n0 " + to_string(objects.size() + 1) + "\n" + xref_line(0, 'f');
+    for (size_t offset : offsets) doc += xref_line(offset, 'n');
+    doc += "trailer\n<< /Size " + to_string(objects.size() + 1) + " /Root " + to_string(root_id) +
+           " 0 R >>\nstartxref\n" + to_string(xref_offset) + "\n%%EOF\n";
+    return doc;
+}
+
+string make_stream_object(const string &dictionary_entries, const string &data)
+{
+    return "<< " + dictionary_entries + " /Length " + to_string(data.size()) + " >>\nstream\n" + data + "\nendstream";
+}
+
+xref_t parse_xref(boost::string_view doc)
+{
+    return get_xref(doc, get_trailer_offsets(doc, get_cross_ref_offset(doc)));
+}
+
+string flate_encode(const string &data)
+{
+    uLongf len = compressBound(data.size());
+    string result(len, '\0');
+    if (compress(reinterpret_cast<Bytef*>(&result[0]), &len, reinterpret_cast<const Bytef*>(data.data()), data.size()) != Z_OK)
+    {
+        throw pdf_error(FUNC_STRING + "compress failed");
+    }
+    result.resize(len);
+    return result;
+}
+
+string lzw_encode(const string &data, bool early_change /*= true*/)
+{
+    unordered_map<string, unsigned int> table;
+    unsigned int next_code = LZW_FIRST_CODE;
+    unsigned int code_len = LZW_MIN_CODE_LEN;
+    BitWriter writer;
+    writer.write(LZW_CLEAR, code_len);
+    string w;
+    auto get_code = [&table](const string &s) { return (s.length() == 1)? static_cast<unsigned char>(s[0]) : table.at(s); };
+    for (char c : data)
+    {
+        string wc = w + c;
+        if (wc.length() == 1 || table.count(wc))
+        {
+            w = std::move(wc);
+            continue;
+        }
+        writer.write(get_code(w), code_len);
+        table.emplace(std::move(wc), next_code++);
+        //decoder adds entry one code later, so with EarlyChange it switches code length when its table has
+        //(2^n - 1) entries and without it when the table is full
+        if (next_code == (1u << code_len) + !early_change && code_len < LZW_MAX_CODE_LEN) ++code_len;
+        if (next_code >= LZW_MAX_CODE)
+        {
+            writer.write(LZW_CLEAR, code_len);
+            table.clear();
+            next_code = LZW_FIRST_CODE;
+            code_len = LZW_MIN_CODE_LEN;
+        }
+        w = string(1, c);
+    }
+    if (!w.empty())
+    {
+        writer.write(get_code(w), code_len);
+        ++next_code;
+        if (next_code == (1u << code_len) + !early_change && code_len < LZW_MAX_CODE_LEN) ++code_len;
+    }
+    writer.write(LZW_EOD, code_len);
+    return writer.finish();
+}
+
+string ascii_hex_encode(const string &data, size_t line_len)
+{
+    const char digits[] = "0123456789ABCDEF";
+    string result;
+    result.reserve(data.size() * 2 + (line_len? data.size() * 2 / line_len : 0) + 1);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        if (line_len && i && (i * 2) % line_len == 0) result.push_back('\n');
+        result.push_back(digits[static_cast<unsigned char>(data[i]) >> 4]);
+        result.push_back(digits[data[i] & 0x0F]);
+    }
+    return result + '>';
+}
+
+string ascii85_encode(const string &data)
+{
+    string result;
+    result.reserve(data.size() / 4 * 5 + 7);
+    for (size_t offset = 0; offset < data.size(); offset += 4)
+    {
+        size_t n = min<size_t>(4, data.size() - offset);
+        uint32_t tuple = 0;
+        for (size_t i = 0; i < 4; ++i)
+        {
+            tuple = (tuple << 8) | ((i < n)? static_cast<unsigned char>(data[offset + i]) : 0);
+        }
+        if (n == 4 && tuple == 0)
+        {
+            result.push_back('z');
+            continue;
+        }
+        char group[5];
+        for (int i = 4; i >= 0; --i)
+        {
+            group[i] = '!' + tuple % 85;
+            tuple /= 85;
+        }
+        result.append(group, n + 1);
+    }
+    return result + "~>";
+}
+
+string run_length_encode(const string &data)
+{
+    enum { MAX_RUN_LEN = 128 };
+    string result;
+    size_t offset = 0;
+    while (offset < data.size())
+    {
+        size_t run = 1;
+        while (run < MAX_RUN_LEN && offset + run < data.size() && data[offset + run] == data[offset]) ++run;
+        if (run > 1)
+        {
+            result.push_back(static_cast<char>(257 - run));
+            result.push_back(data[offset]);
+            offset += run;
+            continue;
+        }
+        size_t len = 1;
+        while (len < MAX_RUN_LEN && offset + len < data.size() &&
+               (offset + len + 1 == data.size() || data[offset + len] != data[offset + len + 1])) ++len;
+        result.push_back(static_cast<char>(len - 1));
+        result.append(data, offset, len);
+        offset += len;
+    }
+    result.push_back(static_cast<char>(128));
+    return result;
+}
+
+string png_encode(const string &data, size_t columns, unsigned int tag)
+{
+    string result;
+    result.reserve(data.size() + data.size() / columns + 1);
+    string prev(columns, '\0');
+    string row(columns, '\0');
+    for (size_t offset = 0; offset < data.size(); offset += columns)
+    {
+        for (size_t i = 0; i < columns; ++i) row[i] = (offset + i < data.size())? data[offset + i] : 0;
+        result.push_back(tag);
+        for (size_t i = 0; i < columns; ++i)
+        {
+            int left = i? static_cast<unsigned char>(row[i - 1]) : 0;
+            int above = static_cast<unsigned char>(prev[i]);
+            int upper_left = i? static_cast<unsigned char>(prev[i - 1]) : 0;
+            int predicted = 0;
+            switch (tag)
+            {
+            case PNG_TAG_SUB:
+                predicted = left;
+                break;
+            case PNG_TAG_UP:
+                predicted = above;
+                break;
+            case PNG_TAG_AVERAGE:
+                predicted = (left + above) >> 1;
+                break;
+            case PNG_TAG_PAETH:
+            {
+                int p = left + above - upper_left;
+                int pa = abs(p - left), pb = abs(p - above), pc = abs(p - upper_left);
+                predicted = (pa <= pb && pa <= pc)? left : (pb <= pc)? above : upper_left;
+                break;
+            }
+            default:
+                break;
+            }
+            result.push_back(row[i] - predicted);
+        }
+        prev.swap(row);
+    }
+    return result;
+}
+
+string make_text_content(size_t lines_num)
+{
+    string result = "q 1 0 0 1 0 0 cm\nBT\n/F1 11 Tf\n14 TL\n72 770 Td\n";
+    for (size_t i = 0; i < lines_num; ++i)
+    {
+        result += "(Line " + to_string(i) + " of synthetic text with some words to render) Tj T*\n";
+        if (i % 4 == 0) result += "[(Kerned) -250 (array) 120 (text)] TJ T*\n";
+    }
+    result += "ET\nQ\n0 0 1 rg 10 10 100 100 re f\n";
+    return result;
+}
+
+string make_path_content(size_t paths_num)
+{
+    string result = "q 0.5 w 0 0 0 RG\n";
+    for (size_t i = 0; i < paths_num; ++i)
+    {
+        size_t x = (i * 37) % 600;
+        size_t y = (i * 53) % 780;
+        result += to_string(x) + ' ' + to_string(y) + " m " + to_string(x + 10) + ".5 " + to_string(y + 4) + " l " +
+                  to_string(x + 12) + ' ' + to_string(y + 8) + ' ' + to_string(x + 16) + ' ' + to_string(y + 2) + ' ' +
+                  to_string(x + 20) + ' ' + to_string(y) + " c S\n";
+        if (i % 8 == 0) result += to_string(x) + ' ' + to_string(y) + " 30 20 re W n 0.2 0.4 0.6 rg f\n";
+    }
+    result += "Q\n";
+    return result;
+}
+
+string make_cmap(size_t codes_num)
+{
+    string result = "/CIDInit /ProcSet findresource begin\n12 dict begin\nbegincmap\n"
+                    "/CIDSystemInfo << /Registry (Adobe) /Ordering (UCS) /Supplement 0 >> def\n"
+                    "/CMapName /Adobe-Identity-UCS def\n/CMapType 2 def\n"
+                    "1 begincodespacerange\n<00> <FF>\nendcodespacerange\n";
+    for (size_t first = 0; first < codes_num; first += 100)
+    {
+        size_t n = min<size_t>(100, codes_num - first);
+        result += to_string(n) + " beginbfchar\n";
+        char line[32];
+        for (size_t code = first; code < first + n; ++code)
+        {
+            snprintf(line, sizeof(line), "<%02zX> <%04zX>\n", (0x20 + code) & 0xFF, 0x20 + code);
+            result += line;
+        }
+        result += "endbfchar\n";
+    }
+    result += "endcmap\nCMapName currentdict /CMap defineresource pop\nend\nend\n";
+    return result;
+}
+
+string make_widths_array(size_t widths_num)
+{
+    string result = "[";
+    for (size_t i = 0; i < widths_num; ++i) result += to_string(250 + (i * 37) % 500) + ((i % 16 == 15)? "\n" : " ");
+    return result + "]";
+}
+
+string make_font_dictionary()
+{
+    return "<< /Type /Font /Subtype /TrueType /BaseFont /Synthetic /FirstChar 32 /LastChar 126 /Widths 5 0 R "
+           "/Encoding /WinAnsiEncoding /ToUnicode 6 0 R >>";
+}
+
+string make_synthetic_document(size_t pages_num, size_t lines_per_page, size_t paths_per_page /*= 0*/)
+{
+    //1 catalog, 2 pages, 3 resources, 4 font, 5 widths, 6 cmap, then page and content pairs
+    vector<string> objects;
+    string kids;
+    for (size_t i = 0; i < pages_num; ++i) kids += to_string(7 + 2 * i) + " 0 R ";
+    objects.push_back("<< /Type /Catalog /Pages 2 0 R >>");
+    objects.push_back("<< /Type /Pages /Kids [" + kids + "] /Count " + to_string(pages_num) +
+                      " /Resources 3 0 R /MediaBox [0 0 612 792] >>");
+    objects.push_back("<< /Font << /F1 4 0 R >> >>");
+    objects.push_back(make_font_dictionary());
+    objects.push_back(make_widths_array(126 - 32 + 1));
+    objects.push_back(make_stream_object("", make_cmap(95)));
+    for (size_t i = 0; i < pages_num; ++i)
+    {
+        objects.push_back("<< /Type /Page /Parent 2 0 R /Contents " + to_string(8 + 2 * i) + " 0 R >>");
+        const string content = make_path_content(paths_per_page) + make_text_content(lines_per_page);
+        objects.push_back(make_stream_object("/Filter /FlateDecode", flate_encode(content)));
+    }
+    return make_document(objects, 1);
+}
@@ -0,0 +1,41 @@
+#ifndef BENCH_UTILS_H
+#define BENCH_UTILS_H
+
+#include <string>
+#include <vector>
+
+#include <boost/utility/string_view.hpp>
+
+#include "common.h"
+
+//synthetic inputs for benchmarks, so they can be run without local pdf files
+
+//returns document with cross-reference table, body of object i + 1 is objects[i]
+std::string make_document(const std::vector<std::string> &objects, size_t root_id);
+std::string make_stream_object(const std::string &dictionary_entries, const std::string &data);
+xref_t parse_xref(boost::string_view doc);
+
+std::string flate_encode(const std::string &data);
+//7.4.4. LZWDecode
+std::string lzw_encode(const std::string &data, bool early_change = true);
+//line_len 0 means one line
+std::string ascii_hex_encode(const std::string &data, size_t line_len);
+std::string ascii85_encode(const std::string &data);
+//7.4.5. RunLengthDecode, runs of at least 2 equal bytes are repeated
+std::string run_length_encode(const std::string &data);
+enum { PNG_TAG_NONE = 0, PNG_TAG_SUB = 1, PNG_TAG_UP = 2, PNG_TAG_AVERAGE = 3, PNG_TAG_PAETH = 4 };
+//the same PNG predictor for every row, 8 bits per component and one color
+std::string png_encode(const std::string &data, size_t columns, unsigned int tag);
+
+std::string make_text_content(size_t lines_num);
+//path construction and painting operators as in CAD drawings and maps
+std::string make_path_content(size_t paths_num);
+//maps codes_num one byte codes starting from space to the same unicode values
+std::string make_cmap(size_t codes_num);
+std::string make_widths_array(size_t widths_num);
+std::string make_font_dictionary();
+
+//document with pages_num pages, every page has paths, text lines and shares font with ToUnicode cmap
+std::string make_synthetic_document(size_t pages_num, size_t lines_per_page, size_t paths_per_page = 0);
+
+#endif //BENCH_UTILS_H
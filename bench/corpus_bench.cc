@@ -0,0 +1,137 @@
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <algorithm>
+#include <exception>
+
+#include <dirent.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.h"
+#include "pdf_extractor.h"
+
+using namespace std;
+
+namespace
+{
+    struct synthetic_document_t
+    {
+        const char *name;
+        size_t pages_num;
+        size_t lines_per_page;
+        size_t paths_per_page;
+    };
+
+    const synthetic_document_t SYNTHETIC_DOCUMENTS[] = {{"synthetic_10_pages", 10, 40, 0},
+                                                        {"synthetic_200_pages", 200, 40, 0},
+                                                        {"synthetic_50_dense_pages", 50, 200, 0},
+                                                        {"synthetic_20_path_pages", 20, 40, 20000}};
+
+    //peak resident set size of the whole process, it never decreases
+    double get_peak_rss_mb()
+    {
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+        return usage.ru_maxrss / 1024.0;
+    }
+
+    size_t get_file_size(const string &path)
+    {
+        struct stat st;
+        return (stat(path.c_str(), &st) == 0)? st.st_size : 0;
+    }
+
+    void report(benchmark::State &state, size_t pages_num, size_t bytes)
+    {
+        state.SetBytesProcessed(state.iterations() * bytes);
+        state.counters["pages/s"] = benchmark::Counter(state.iterations() * pages_num, benchmark::Counter::kIsRate);
+        state.counters["peak_rss_MB"] = get_peak_rss_mb();
+    }
+
+    void BM_synthetic_document(benchmark::State &state, shared_ptr<const string> doc)
+    {
+        size_t pages_num = 0;
+        for (auto _ : state)
+        {
+            PdfDocument document(*doc);
+            pages_num = document.get_pages_count();
+            benchmark::DoNotOptimize(document.get_text(state.range(0)));
+        }
+        report(state, pages_num, doc->size());
+    }
+
+    void BM_corpus_file(benchmark::State &state, const string &path)
+    {
+        size_t pages_num = 0;
+        size_t skipped_bytes = 0;
+        size_t cache_hits = 0, cache_misses = 0;
+        for (auto _ : state)
+        {
+            try
+            {
+                size_t text_len = 0;
+                PdfDocument document = PdfDocument::map_file(path);
+                pages_num = document.get_pages_count();
+                document.extract_pages([&text_len](size_t, const string &text) { text_len += text.size(); },
+                                       state.range(0));
+                benchmark::DoNotOptimize(text_len);
+                skipped_bytes = document.get_skipped_bytes();
+                cache_hits = document.get_cache_hits();
+                cache_misses = document.get_cache_misses();
+            }
+            catch (const exception &e)
+            {
+                state.SkipWithError(e.what());
+                break;
+            }
+        }
+        report(state, pages_num, get_file_size(path));
+        //images and other streams without text which weren`t decoded
+        state.counters["skipped_MB"] = skipped_bytes / 1048576.0;
+        //parsed objects cache of the last iteration
+        state.counters["cache_hits"] = cache_hits;
+        state.counters["cache_misses"] = cache_misses;
+    }
+
+    vector<string> get_pdf_files(const string &dir)
+    {
+        vector<string> result;
+        DIR *d = opendir(dir.c_str());
+        if (!d) return result;
+        while (struct dirent *entry = readdir(d))
+        {
+            const string name = entry->d_name;
+            if (name.size() > 4 && name.compare(name.size() - 4, 4, ".pdf") == 0) result.push_back(dir + '/' + name);
+        }
+        closedir(d);
+        sort(result.begin(), result.end());
+        return result;
+    }
+
+    template <class T> void apply_threads(T *bm)
+    {
+        bm->Arg(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+        unsigned int cores = thread::hardware_concurrency();
+        if (cores > 1) bm->Arg(cores);
+    }
+}
+
+//argument of every corpus benchmark is number of extraction threads
+void register_corpus_benchmarks(const string &corpus_dir)
+{
+    for (const synthetic_document_t &d : SYNTHETIC_DOCUMENTS)
+    {
+        const string content = make_synthetic_document(d.pages_num, d.lines_per_page, d.paths_per_page);
+        shared_ptr<const string> doc = make_shared<const string>(content);
+        apply_threads(benchmark::RegisterBenchmark((string("BM_corpus/") + d.name).c_str(), BM_synthetic_document, doc));
+    }
+    if (corpus_dir.empty()) return;
+    for (const string &path : get_pdf_files(corpus_dir))
+    {
+        apply_threads(benchmark::RegisterBenchmark(("BM_corpus/" + path).c_str(), BM_corpus_file, path));
+    }
+}
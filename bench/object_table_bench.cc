@@ -0,0 +1,177 @@
+#include <string>
+#include <map>
+#include <utility>
+#include <vector>
+#include <random>
+#include <cstdio>
+
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.h"
+#include "common.h"
+#include "object_storage.h"
+
+using namespace std;
+
+namespace
+{
+    enum
+    {
+        OBJECTS_NUM = 100000,
+        OBJECTS_PER_STREAM = 100,
+        LOOKUPS_NUM = 4096
+    };
+
+    string xref_line(size_t offset, char status)
+    {
+        char line[21];
+        snprintf(line, sizeof(line), "%010zu 00000 %c\r\n", offset, status);
+        return line;
+    }
+
+    //document with OBJECTS_NUM small dictionaries referenced by xref table
+    string make_plain_document()
+    {
+        vector<string> objects;
+        objects.reserve(OBJECTS_NUM);
+        for (size_t id = 1; id <= OBJECTS_NUM; ++id)
+        {
+            objects.push_back("<< /Type /Test /Id " + to_string(id) + " /Next " + to_string(id % OBJECTS_NUM + 1) +
+                              " 0 R >>");
+        }
+        return make_document(objects, 1);
+    }
+
+    //document with OBJECTS_NUM small dictionaries packed into uncompressed object streams
+    string make_obj_stm_document()
+    {
+        string doc = "%PDF-1.5\n";
+        vector<size_t> offsets;
+        size_t stm_id = OBJECTS_NUM + 1;
+        for (size_t first_id = 1; first_id <= OBJECTS_NUM; first_id += OBJECTS_PER_STREAM, ++stm_id)
+        {
+            string header, body;
+            for (size_t id = first_id; id < first_id + OBJECTS_PER_STREAM; ++id)
+            {
+                header += to_string(id) + ' ' + to_string(body.size()) + ' ';
+                body += "<< /Type /Test /Id " + to_string(id) + " >>\n";
+            }
+            offsets.push_back(doc.size());
+            doc += to_string(stm_id) + " 0 obj\n<< /Type /ObjStm /N " + to_string(OBJECTS_PER_STREAM) +
+                   " /First " + to_string(header.size()) + " /Length " + to_string(header.size() + body.size()) +
+                   " >>\nstream\n" + header + body + "\nendstream\nendobj\n";
+        }
+        size_t xref_offset = doc.size();
+        doc += "xref\n0 1\n" + xref_line(0, 'f') + to_string(OBJECTS_NUM + 1) + ' ' + to_string(offsets.size()) + "\n";
+        for (size_t offset : offsets) doc += xref_line(offset, 'n');
+        doc += "trailer\n<< /Size " + to_string(stm_id) + " >>\nstartxref\n" + to_string(xref_offset) + "\n%%EOF\n";
+        return doc;
+    }
+
+    const string& plain_document()
+    {
+        static const string doc = make_plain_document();
+        return doc;
+    }
+
+    const string& obj_stm_document()
+    {
+        static const string doc = make_obj_stm_document();
+        return doc;
+    }
+
+    vector<size_t> random_ids()
+    {
+        mt19937 gen(42);
+        uniform_int_distribution<size_t> dist(1, OBJECTS_NUM);
+        vector<size_t> ids(LOOKUPS_NUM);
+        for (size_t &id : ids) id = dist(gen);
+        return ids;
+    }
+
+    //former representation of cross-reference data
+    map<size_t, size_t> xref2map(const xref_t &xref)
+    {
+        map<size_t, size_t> result;
+        for (size_t id = 0; id < xref.size(); ++id)
+        {
+            if (xref[id].type == xref_entry_t::IN_USE) result.emplace(id, xref[id].value);
+        }
+        return result;
+    }
+}
+
+static void BM_offset_lookup_map(benchmark::State &state)
+{
+    const map<size_t, size_t> id2offsets = xref2map(parse_xref(plain_document()));
+    const vector<size_t> ids = random_ids();
+    for (auto _ : state)
+    {
+        for (size_t id : ids) benchmark::DoNotOptimize(id2offsets.at(id));
+    }
+    state.SetItemsProcessed(state.iterations() * ids.size());
+}
+BENCHMARK(BM_offset_lookup_map);
+
+static void BM_offset_lookup_dense(benchmark::State &state)
+{
+    const xref_t xref = parse_xref(plain_document());
+    const vector<size_t> ids = random_ids();
+    for (auto _ : state)
+    {
+        for (size_t id : ids) benchmark::DoNotOptimize(get_object_offset(id, xref));
+    }
+    state.SetItemsProcessed(state.iterations() * ids.size());
+}
+BENCHMARK(BM_offset_lookup_dense);
+
+static void BM_get_object(benchmark::State &state)
+{
+    const string &doc = plain_document();
+    const dict_t decrypt_data;
+    ObjectStorage storage(doc, parse_xref(doc), decrypt_data);
+    const vector<size_t> ids = random_ids();
+    for (auto _ : state)
+    {
+        for (size_t id : ids) benchmark::DoNotOptimize(storage.get_object(id));
+    }
+    state.SetItemsProcessed(state.iterations() * ids.size());
+}
+BENCHMARK(BM_get_object);
+
+static void BM_obj_stm_lookup_map(benchmark::State &state)
+{
+    const string &doc = obj_stm_document();
+    const dict_t decrypt_data;
+    ObjectStorage storage(doc, parse_xref(doc), decrypt_data);
+    map<size_t, pair<string, pdf_object_t>> id2obj_stm;
+    for (size_t id = 1; id <= OBJECTS_NUM; ++id) id2obj_stm.emplace(id, storage.get_object(id));
+    const vector<size_t> ids = random_ids();
+    for (auto _ : state)
+    {
+        //ObjectStorage returns objects by value, so copy them here too
+        for (size_t id : ids)
+        {
+            pair<string, pdf_object_t> obj = id2obj_stm.at(id);
+            benchmark::DoNotOptimize(obj);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * ids.size());
+}
+BENCHMARK(BM_obj_stm_lookup_map);
+
+static void BM_obj_stm_lookup_dense(benchmark::State &state)
+{
+    const string &doc = obj_stm_document();
+    const dict_t decrypt_data;
+    ObjectStorage storage(doc, parse_xref(doc), decrypt_data);
+    //decode all object streams before measurement
+    storage.get_object(1);
+    const vector<size_t> ids = random_ids();
+    for (auto _ : state)
+    {
+        for (size_t id : ids) benchmark::DoNotOptimize(storage.get_object(id));
+    }
+    state.SetItemsProcessed(state.iterations() * ids.size());
+}
+BENCHMARK(BM_obj_stm_lookup_dense);
@@ -0,0 +1,305 @@
+#include <string>
+#include <vector>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.h"
+#include "common.h"
+#include "predictor.h"
+#include "filter_chain.h"
+#include "object_storage.h"
+#include "decrypt.h"
+#include "cmap.h"
+#include "fonts.h"
+#include "coordinates.h"
+#include "converter_engine.h"
+#include "content_lexer.h"
+
+using namespace std;
+
+extern string flate_decode(const string&, const dict_t&);
+extern string lzw_decode(const string&, const dict_t&);
+extern string ascii_hex_decode(const string&, const dict_t&);
+extern string ascii85_decode(const string&, const dict_t&);
+extern string run_length_decode(const string&, const dict_t&);
+extern string legacy_lzw_decode(const string&);
+extern text_chunk_t make_plane(vector<text_chunk_t> &&boxes);
+
+namespace
+{
+    enum { CONTENT_LINES_NUM = 2000, XREF_STREAM_COLUMNS = 5 };
+
+    const string& text_content()
+    {
+        static const string content = make_text_content(CONTENT_LINES_NUM);
+        return content;
+    }
+
+    //xref stream like data: 1 type byte, 3 offset bytes and 1 generation byte per entry
+    string xref_stream_rows()
+    {
+        string result;
+        for (unsigned int i = 0; i < 100000; ++i)
+        {
+            unsigned int offset = 15 + i * 97;
+            result += {1, static_cast<char>(offset >> 16), static_cast<char>(offset >> 8), static_cast<char>(offset), 0};
+        }
+        return result;
+    }
+
+    dict_t predictor_opts(size_t columns)
+    {
+        return dict_t{{"/Predictor", make_pair("15", VALUE)},
+                      {"/Columns", make_pair(to_string(columns), VALUE)}};
+    }
+
+    //document with font which has widths and ToUnicode cmap, object 4 is font dictionary
+    struct font_document_t
+    {
+        font_document_t() :
+            doc(make_synthetic_document(1, 1)),
+            storage(doc, parse_xref(doc), decrypt_data),
+            fonts(storage, dict_t{{"/F1", make_pair(string("4 0 R"), INDIRECT_OBJECT)}})
+        {
+            fonts.set_current_font("/F1");
+        }
+
+        const string doc;
+        const dict_t decrypt_data;
+        ObjectStorage storage;
+        Fonts fonts;
+    };
+
+    vector<text_chunk_t> make_boxes(size_t boxes_num)
+    {
+        //two columns of paragraphs
+        vector<text_chunk_t> boxes;
+        for (size_t i = 0; i < boxes_num; ++i)
+        {
+            float x = (i % 2)? 320 : 72;
+            float y = 770 - (i / 2) * 30;
+            boxes.emplace_back("paragraph " + to_string(i), coordinates_t(x, y - 24, x + 220, y));
+        }
+        return boxes;
+    }
+}
+
+static void BM_get_dictionary_data(benchmark::State &state)
+{
+    const string dictionary = "<< /Type /Page /Parent 2 0 R /MediaBox [0 0 612 792] /CropBox [0 0 612 792] "
+                              "/Resources << /Font << /F1 4 0 R /F2 5 0 R >> /XObject << /Im1 6 0 R >> "
+                              "/ProcSet [/PDF /Text /ImageB] >> /Contents [7 0 R 8 0 R] /Rotate 0 "
+                              "/Annots [9 0 R 10 0 R] /Group << /S /Transparency /CS /DeviceRGB >> "
+                              "/Title (Synthetic \\(page\\) title) /ID <0123456789ABCDEF> >>";
+    for (auto _ : state) benchmark::DoNotOptimize(get_dictionary_data(dictionary, 0));
+    state.SetBytesProcessed(state.iterations() * dictionary.size());
+}
+BENCHMARK(BM_get_dictionary_data);
+
+static void BM_get_array_data(benchmark::State &state)
+{
+    const string array = make_widths_array(state.range(0));
+    for (auto _ : state) benchmark::DoNotOptimize(get_array_data(array, 0));
+    state.SetBytesProcessed(state.iterations() * array.size());
+}
+BENCHMARK(BM_get_array_data)->Arg(16)->Arg(256)->Arg(4096);
+
+static void BM_get_content_token(benchmark::State &state)
+{
+    const string &content = text_content();
+    for (auto _ : state)
+    {
+        size_t offset = 0;
+        size_t operands = 0;
+        for (content_token_t token = get_content_token(content, offset);
+             token.op != OP_END;
+             token = get_content_token(content, offset))
+        {
+            if (token.op == OP_NONE) ++operands;
+        }
+        benchmark::DoNotOptimize(operands);
+    }
+    state.SetBytesProcessed(state.iterations() * content.size());
+}
+BENCHMARK(BM_get_content_token);
+
+static void BM_skim_graphics(benchmark::State &state)
+{
+    const string content = make_path_content(CONTENT_LINES_NUM * 10);
+    //paths between opening q and closing Q
+    size_t start = content.find('\n');
+    if (skim_graphics(content, start) != content.rfind('Q')) throw pdf_error(FUNC_STRING + "paths weren`t skipped");
+    for (auto _ : state) benchmark::DoNotOptimize(skim_graphics(content, start));
+    state.SetBytesProcessed(state.iterations() * content.size());
+}
+BENCHMARK(BM_skim_graphics);
+
+static void BM_flate_decode(benchmark::State &state)
+{
+    const string encoded = flate_encode(text_content());
+    const dict_t opts;
+    for (auto _ : state) benchmark::DoNotOptimize(flate_decode(encoded, opts));
+    state.SetBytesProcessed(state.iterations() * text_content().size());
+}
+BENCHMARK(BM_flate_decode);
+
+//argument is /EarlyChange
+static void BM_lzw_decode(benchmark::State &state)
+{
+    const string encoded = lzw_encode(text_content(), state.range(0));
+    const dict_t opts{{"/EarlyChange", make_pair(to_string(state.range(0)), VALUE)}};
+    if (lzw_decode(encoded, opts) != text_content()) throw pdf_error(FUNC_STRING + "lzw round trip failed");
+    for (auto _ : state) benchmark::DoNotOptimize(lzw_decode(encoded, opts));
+    state.SetBytesProcessed(state.iterations() * text_content().size());
+}
+BENCHMARK(BM_lzw_decode)->Arg(0)->Arg(1);
+
+static void BM_lzw_decode_legacy(benchmark::State &state)
+{
+    const string encoded = lzw_encode(text_content());
+    if (legacy_lzw_decode(encoded) != text_content()) throw pdf_error(FUNC_STRING + "lzw round trip failed");
+    for (auto _ : state) benchmark::DoNotOptimize(legacy_lzw_decode(encoded));
+    state.SetBytesProcessed(state.iterations() * text_content().size());
+}
+BENCHMARK(BM_lzw_decode_legacy);
+
+//argument is length of encoded lines, 0 means one line
+static void BM_ascii_hex_decode(benchmark::State &state)
+{
+    const string encoded = ascii_hex_encode(text_content(), state.range(0));
+    const dict_t opts;
+    if (ascii_hex_decode(encoded, opts) != text_content()) throw pdf_error(FUNC_STRING + "hex round trip failed");
+    for (auto _ : state) benchmark::DoNotOptimize(ascii_hex_decode(encoded, opts));
+    state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+BENCHMARK(BM_ascii_hex_decode)->Arg(0)->Arg(64);
+
+static void BM_ascii85_decode(benchmark::State &state)
+{
+    const string encoded = ascii85_encode(text_content());
+    const dict_t opts;
+    if (ascii85_decode(encoded, opts) != text_content()) throw pdf_error(FUNC_STRING + "ascii85 round trip failed");
+    for (auto _ : state) benchmark::DoNotOptimize(ascii85_decode(encoded, opts));
+    state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+BENCHMARK(BM_ascii85_decode);
+
+static void BM_run_length_decode(benchmark::State &state)
+{
+    const string encoded = run_length_encode(text_content());
+    const dict_t opts;
+    if (run_length_decode(encoded, opts) != text_content()) throw pdf_error(FUNC_STRING + "run length round trip failed");
+    for (auto _ : state) benchmark::DoNotOptimize(run_length_decode(encoded, opts));
+    state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+BENCHMARK(BM_run_length_decode);
+
+//[/ASCII85Decode /FlateDecode] content stream
+static void BM_filter_chain(benchmark::State &state)
+{
+    const string encoded = ascii85_encode(flate_encode(text_content()));
+    const vector<string> filters{"/ASCII85Decode", "/FlateDecode"};
+    const vector<dict_t> decode_params(filters.size());
+    if (FilterChain(encoded, filters, decode_params).read_all() != text_content())
+    {
+        throw pdf_error(FUNC_STRING + "filter chain round trip failed");
+    }
+    for (auto _ : state) benchmark::DoNotOptimize(FilterChain(encoded, filters, decode_params).read_all());
+    state.SetBytesProcessed(state.iterations() * text_content().size());
+}
+BENCHMARK(BM_filter_chain);
+
+//7.6.2. RC4 with 128 bit key is symmetric, so decryption of decrypted data restores it
+static void BM_rc4_decrypt(benchmark::State &state)
+{
+    const string hex_value = "<" + string(64, 'A') + ">";
+    const Decryptor decryptor(dict_t{{"/Filter", make_pair(string("/Standard"), NAME_OBJECT)},
+                                     {"/R", make_pair(string("3"), VALUE)},
+                                     {"/Length", make_pair(string("128"), VALUE)},
+                                     {"/P", make_pair(string("-1044"), VALUE)},
+                                     {"/O", make_pair(hex_value, STRING)},
+                                     {"/ID", make_pair("[" + hex_value + hex_value + "]", ARRAY)}});
+    string data = text_content();
+    decryptor.decrypt(1, 0, data);
+    if (data == text_content()) throw pdf_error(FUNC_STRING + "data isn`t encrypted");
+    decryptor.decrypt(1, 0, data);
+    if (data != text_content()) throw pdf_error(FUNC_STRING + "rc4 round trip failed");
+    for (auto _ : state)
+    {
+        decryptor.decrypt(1, 0, data);
+        benchmark::DoNotOptimize(data);
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_rc4_decrypt);
+
+//arguments are columns and PNG predictor of rows. 5 columns are rows of xref stream, 1024 are rows of image
+static void BM_predictor_decode(benchmark::State &state)
+{
+    string rows = xref_stream_rows();
+    rows.resize(rows.size() / state.range(0) * state.range(0));
+    const string encoded = png_encode(rows, state.range(0), state.range(1));
+    const dict_t opts = predictor_opts(state.range(0));
+    if (predictor_decode(encoded, opts) != rows) throw pdf_error(FUNC_STRING + "predictor round trip failed");
+    for (auto _ : state) benchmark::DoNotOptimize(predictor_decode(encoded, opts));
+    state.SetBytesProcessed(state.iterations() * rows.size());
+}
+BENCHMARK(BM_predictor_decode)->ArgsProduct({{XREF_STREAM_COLUMNS, 1024},
+                                             {PNG_TAG_SUB, PNG_TAG_UP, PNG_TAG_AVERAGE, PNG_TAG_PAETH}});
+
+//compressed xref stream: inflate and predictor in one pass
+static void BM_flate_predictor_decode(benchmark::State &state)
+{
+    const string rows = xref_stream_rows();
+    const string encoded = flate_encode(png_encode(rows, XREF_STREAM_COLUMNS, PNG_TAG_UP));
+    const dict_t opts = predictor_opts(XREF_STREAM_COLUMNS);
+    if (flate_decode(encoded, opts) != rows) throw pdf_error(FUNC_STRING + "flate predictor round trip failed");
+    for (auto _ : state) benchmark::DoNotOptimize(flate_decode(encoded, opts));
+    state.SetBytesProcessed(state.iterations() * rows.size());
+}
+BENCHMARK(BM_flate_predictor_decode);
+
+static void BM_get_cmap(benchmark::State &state)
+{
+    const string doc = make_document({make_stream_object("", make_cmap(state.range(0)))}, 1);
+    const dict_t decrypt_data;
+    ObjectStorage storage(doc, parse_xref(doc), decrypt_data);
+    for (auto _ : state) benchmark::DoNotOptimize(get_cmap(doc, storage, make_pair(1u, 0u)));
+}
+BENCHMARK(BM_get_cmap)->Arg(16)->Arg(256);
+
+static void BM_converter_engine_get_string(benchmark::State &state)
+{
+    font_document_t font_document;
+    cmap_t cmap = get_cmap(font_document.doc, font_document.storage, make_pair(6u, 0u));
+    const ConverterEngine engine = state.range(0)? ConverterEngine(CharsetConverter(string()),
+                                                                   DiffConverter(),
+                                                                   ToUnicodeConverter(cmap)) :
+                                                   ConverterEngine(CharsetConverter("/WinAnsiEncoding"),
+                                                                   DiffConverter(),
+                                                                   ToUnicodeConverter());
+    const string str = "Line of synthetic text with some words to render";
+    Coordinates coordinates(IDENTITY_MATRIX);
+    operand_stack_t st;
+    st.push(operand_t{"/F1", 0, NAME_OBJECT});
+    st.push(operand_t{"11", 11, VALUE});
+    coordinates.set_Tf(st);
+    for (auto _ : state) benchmark::DoNotOptimize(engine.get_string(str, coordinates, 0, font_document.fonts));
+    state.SetBytesProcessed(state.iterations() * str.size());
+}
+//0 - simple font encoding, 1 - ToUnicode cmap
+BENCHMARK(BM_converter_engine_get_string)->Arg(0)->Arg(1);
+
+static void BM_make_plane(benchmark::State &state)
+{
+    const vector<text_chunk_t> boxes = make_boxes(state.range(0));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        vector<text_chunk_t> input = boxes;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(make_plane(std::move(input)));
+    }
+}
+BENCHMARK(BM_make_plane)->Arg(16)->Arg(64)->Arg(256);
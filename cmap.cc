@@ -213,13 +213,12 @@ namespace
     }
 }
 
-cmap_t get_cmap(const string &doc,
+cmap_t get_cmap(boost::string_view doc,
                 const ObjectStorage &storage,
-                const pair<unsigned int, unsigned int> &cmap_id_gen,
-                const dict_t &decrypt_data)
+                const pair<unsigned int, unsigned int> &cmap_id_gen)
 {
     State_t state = NONE;
-    const string stream = get_stream(doc, cmap_id_gen, storage, decrypt_data);
+    const string stream = get_stream(doc, cmap_id_gen, storage);
     cmap_t result;
     result.is_vertical = false;
     for (size_t start = stream.find_first_not_of(" \t\n\r"), end = stream.find_first_of(" \t\n\r", start);
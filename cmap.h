@@ -23,9 +23,8 @@ struct cmap_t
     bool is_vertical;
 };
 
-extern cmap_t get_cmap(const std::string &doc,
+extern cmap_t get_cmap(boost::string_view doc,
                        const ObjectStorage &storage,
-                       const std::pair<unsigned int, unsigned int> &cmap_id_gen,
-                       const dict_t &decrypt_data);
+                       const std::pair<unsigned int, unsigned int> &cmap_id_gen);
 
 #endif //CMAP_H
@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
 #include <cctype>
 #include <utility>
 #include <array>
@@ -12,18 +13,15 @@
 #include "common.h"
 #include "charset_converter.h"
 #include "object_storage.h"
+#include "filter_chain.h"
 
 using namespace std;
 
-extern string decrypt(unsigned int n, unsigned int g, const string &in, const dict_t &decrypt_opts);
-extern string flate_decode(const string&, const dict_t&);
-extern string lzw_decode(const string&, const dict_t&);
-extern string ascii85_decode(const string&, const dict_t&);
-extern string ascii_hex_decode(const string&, const dict_t&);
+extern string hex_decode(boost::string_view hex);
 
 namespace
 {
-    char get_octal_char(const string &str, size_t &i)
+    char get_octal_char(boost::string_view str, size_t &i)
     {
         // PDF doc: The number ddd may consist of one, two, or three octal digits; high-order overflow shall be ignored.
         //          Three octal digits shall be used, with leading zeros as needed, if the next character of the string
@@ -36,7 +34,7 @@ namespace
         size_t len = j - i;
         if (len > 3) len = (str[i] == 0)? 4 : 3; //leading zero as oct mark
 
-        size_t result = strict_stoul(str.substr(i, len).c_str(), 8);
+        size_t result = strict_stoul(str.substr(i, len).to_string(), 8);
         if (result > numeric_limits<unsigned char>::max())
         {
             throw pdf_error(FUNC_STRING + "octal number " + to_string(result) + " is larger than 8 bit");
@@ -45,7 +43,7 @@ namespace
         return static_cast<char>(result);
     }
 
-    char get_unescaped_char(const string &str, size_t &i)
+    char get_unescaped_char(boost::string_view str, size_t &i)
     {
         if (i == str.size() - 2) return char();
 //Table 3 –  Escape sequences in literal strings
@@ -73,7 +71,7 @@ namespace
         return str[i];
     }
 
-    string unescape_string(const string &str)
+    string unescape_string(boost::string_view str)
     {
         string result;
         result.reserve(str.size());
@@ -85,35 +83,12 @@ namespace
         return result;
     }
 
-    string hex_decode(const string &arg)
-    {
-        string hex;
-        hex.reserve(arg.size());
-        for (size_t i = 1; i < arg.size() - 1; ++i)
-        {
-            if (arg[i] != '\n' && arg[i] != '\r' && arg[i] != ' ') hex += arg[i];
-        }
-        string result;
-        result.reserve(hex.size());
-        for (size_t i = 0; i < hex.length(); i += 2) result.append(1, static_cast<char>(strict_stoul(hex.substr(i, 2), 16)));
-
-        return result;
-    }
-
-    unsigned int get_decode_key(const dict_t &opts, const string &key, unsigned int def)
-    {
-        auto it = opts.find(key);
-        if (it == opts.end()) return def;
-
-        return strict_stoul(it->second.first);
-    }
-
-    size_t find_name_end_delimiter(const string &buffer, size_t offset)
+    size_t find_name_end_delimiter(boost::string_view buffer, size_t offset)
     {
         return efind_first(buffer, "\r\t\n /](<>", offset + 1);
     }
 
-    size_t find_value_end_delimiter(const string &buffer, size_t offset)
+    size_t find_value_end_delimiter(boost::string_view buffer, size_t offset)
     {
         return efind_first(buffer, "\r\t\n /][(<>", offset);
     }
@@ -158,21 +133,21 @@ namespace
         return result;
     }
 
-    bool is_indirect_number(const string &s, size_t &offset)
+    bool is_indirect_number(boost::string_view s, size_t &offset)
     {
         static const char* DIGITS = "0123456789";
         static const char* SPACE = "\n\t\r ";
 
         if (!isdigit(s[offset])) return false;
         offset = s.find_first_not_of(DIGITS, offset);
-        if (offset == string::npos) return false;
+        if (offset == boost::string_view::npos) return false;
         if (!isspace(s[offset])) return false;
         offset = s.find_first_not_of(SPACE, offset);
-        if (offset == string::npos) return false;
+        if (offset == boost::string_view::npos) return false;
         return true;
     }
 
-    bool is_indirect_object(const string &s, size_t offset)
+    bool is_indirect_object(boost::string_view s, size_t offset)
     {
         static const unsigned int INDIRECT_NUMBERS = 2;
         for (unsigned int i = 0; i < INDIRECT_NUMBERS; ++i)
@@ -182,19 +157,23 @@ namespace
         return (s[offset] == 'R')? true : false;
     }
 
-    const map<string, string (&)(const string&, const dict_t&)> FILTER2FUNC = {{"/FlateDecode", flate_decode},
-                                                                               {"/LZWDecode", lzw_decode},
-                                                                               {"/ASCII85Decode", ascii85_decode},
-                                                                               {"/ASCIIHexDecode", ascii_hex_decode}};
-
+    const set<string> IMAGE_FILTERS = {"/CCITTFaxDecode", "/CCF", "/DCTDecode", "/DCT", "/JBIG2Decode", "/JPXDecode"};
 }
 
-const map<pdf_object_t, string (&)(const string&, size_t&)> TYPE2FUNC = {{DICTIONARY, get_dictionary},
-                                                                         {ARRAY, get_array},
-                                                                         {STRING, get_string},
-                                                                         {VALUE, get_value},
-                                                                         {INDIRECT_OBJECT, get_indirect_object},
-                                                                         {NAME_OBJECT, get_name_object}};
+const map<pdf_object_t, string (&)(boost::string_view, size_t&)> TYPE2FUNC = {{DICTIONARY, get_dictionary},
+                                                                             {ARRAY, get_array},
+                                                                             {STRING, get_string},
+                                                                             {VALUE, get_value},
+                                                                             {INDIRECT_OBJECT, get_indirect_object},
+                                                                             {NAME_OBJECT, get_name_object}};
+
+const map<pdf_object_t, boost::string_view (&)(boost::string_view, size_t&)> TYPE2VIEWFUNC =
+    {{DICTIONARY, get_dictionary_view},
+     {ARRAY, get_array_view},
+     {STRING, get_string_view},
+     {VALUE, get_value_view},
+     {INDIRECT_OBJECT, get_indirect_object_view},
+     {NAME_OBJECT, get_name_object_view}};
 
 bool is_blank(char c)
 {
@@ -202,73 +181,73 @@ bool is_blank(char c)
     return false;
 }
 
-size_t efind_first(const string &src, const string& str, size_t pos)
+size_t efind_first(boost::string_view src, const string& str, size_t pos)
 {
    size_t ret = src.find_first_of(str, pos);
-    if (ret == string::npos) throw pdf_error(FUNC_STRING + "for " + str + " in pos " + to_string(pos) + " failed");
+    if (ret == boost::string_view::npos) throw pdf_error(FUNC_STRING + "for " + str + " in pos " + to_string(pos) + " failed");
     return ret;
 }
 
-size_t efind_first(const string &src, const char* s, size_t pos)
+size_t efind_first(boost::string_view src, const char* s, size_t pos)
 {
     size_t ret = src.find_first_of(s, pos);
-    if (ret == string::npos) throw pdf_error(FUNC_STRING + "for " + s + " in pos " + to_string(pos) + " failed");
+    if (ret == boost::string_view::npos) throw pdf_error(FUNC_STRING + "for " + s + " in pos " + to_string(pos) + " failed");
     return ret;
 }
 
-size_t efind_first(const string &src, const char* s, size_t pos, size_t n)
+size_t efind_first(boost::string_view src, const char* s, size_t pos, size_t n)
 {
     size_t ret = src.find_first_of(s, pos, n);
-    if (ret == string::npos) throw pdf_error(FUNC_STRING + "for " + s + " in pos " + to_string(pos) + " failed");
+    if (ret == boost::string_view::npos) throw pdf_error(FUNC_STRING + "for " + s + " in pos " + to_string(pos) + " failed");
     return ret;
 }
 
-size_t efind_first_not(const string &src, const string& str, size_t pos)
+size_t efind_first_not(boost::string_view src, const string& str, size_t pos)
 {
     size_t ret = src.find_first_not_of(str, pos);
-    if (ret == string::npos) throw pdf_error(FUNC_STRING + "for " + str + " in pos " + to_string(pos) + " failed");
+    if (ret == boost::string_view::npos) throw pdf_error(FUNC_STRING + "for " + str + " in pos " + to_string(pos) + " failed");
     return ret;
 }
 
-size_t efind_first_not(const string &src, const char* s, size_t pos)
+size_t efind_first_not(boost::string_view src, const char* s, size_t pos)
 {
     size_t ret = src.find_first_not_of(s, pos);
-    if (ret == string::npos) throw pdf_error(FUNC_STRING + "for " + s + " in pos " + to_string(pos) + " failed");
+    if (ret == boost::string_view::npos) throw pdf_error(FUNC_STRING + "for " + s + " in pos " + to_string(pos) + " failed");
     return ret;
 }
 
-size_t efind_first_not(const string &src, const char* s, size_t pos, size_t n)
+size_t efind_first_not(boost::string_view src, const char* s, size_t pos, size_t n)
 {
     size_t ret = src.find_first_not_of(s, pos, n);
-    if (ret == string::npos) throw pdf_error(FUNC_STRING + "for " + s + " in pos " + to_string(pos) + " failed");
+    if (ret == boost::string_view::npos) throw pdf_error(FUNC_STRING + "for " + s + " in pos " + to_string(pos) + " failed");
     return ret;
 }
 
-size_t efind(const string &src, const string& str, size_t pos)
+size_t efind(boost::string_view src, const string& str, size_t pos)
 {
     size_t ret = src.find(str, pos);
-    if (ret == string::npos) throw pdf_error(FUNC_STRING + "for " + str + " in pos " + to_string(pos) + " failed");
+    if (ret == boost::string_view::npos) throw pdf_error(FUNC_STRING + "for " + str + " in pos " + to_string(pos) + " failed");
     return ret;
 }
 
-size_t efind(const string &src, const char* s, size_t pos)
+size_t efind(boost::string_view src, const char* s, size_t pos)
 {
     size_t ret = src.find(s, pos);
-    if (ret == string::npos) throw pdf_error(FUNC_STRING + "for " + s + " in pos " + to_string(pos) + " failed");
+    if (ret == boost::string_view::npos) throw pdf_error(FUNC_STRING + "for " + s + " in pos " + to_string(pos) + " failed");
     return ret;
 }
 
-size_t efind(const string &src, char c, size_t pos)
+size_t efind(boost::string_view src, char c, size_t pos)
 {
     size_t ret = src.find(c, pos);
-    if (ret == string::npos) throw pdf_error(FUNC_STRING + "for " + c + " in pos " + to_string(pos) + " failed");
+    if (ret == boost::string_view::npos) throw pdf_error(FUNC_STRING + "for " + c + " in pos " + to_string(pos) + " failed");
     return ret;
 }
 
-size_t skip_spaces(const string &buffer, size_t offset, bool validate /*= true */)
+size_t skip_spaces(boost::string_view buffer, size_t offset, bool validate /*= true */)
 {
     offset = buffer.find_first_not_of("\r\n \t", offset);
-    if (validate && offset == string::npos) throw pdf_error(FUNC_STRING + "no data after space");
+    if (validate && offset == boost::string_view::npos) throw pdf_error(FUNC_STRING + "no data after space");
     return offset;
 }
 
@@ -280,14 +259,14 @@ string get_token(const string &page_content, size_t &i)
     return page_content.substr(start, i - start);
 }
 
-size_t skip_comments(const string &buffer, size_t offset, bool validate /*= true */)
+size_t skip_comments(boost::string_view buffer, size_t offset, bool validate /*= true */)
 {
     while (true)
     {
         offset = skip_spaces(buffer, offset, validate);
-        if (offset == string::npos || buffer[offset] != '%') return offset;
+        if (offset == boost::string_view::npos || buffer[offset] != '%') return offset;
         offset = buffer.find_first_of("\r\n", offset);
-        if (offset == string::npos)
+        if (offset == boost::string_view::npos)
         {
             if (validate) throw pdf_error(FUNC_STRING + "no data after comments");
             return offset;
@@ -295,7 +274,7 @@ size_t skip_comments(const string &buffer, size_t offset, bool validate /*= true
     }
 }
 
-pdf_object_t get_object_type(const string &buffer, size_t &offset)
+pdf_object_t get_object_type(boost::string_view buffer, size_t &offset)
 {
     offset = skip_comments(buffer, offset);
     if (offset + 1 == buffer.length()) throw pdf_error(FUNC_STRING + "not enough data");
@@ -315,7 +294,7 @@ pdf_object_t get_object_type(const string &buffer, size_t &offset)
     }
 }
 
-string get_dictionary(const string &buffer, size_t &offset)
+boost::string_view get_dictionary_view(boost::string_view buffer, size_t &offset)
 {
     unsigned int prevs = 0;
     size_t end_offset = offset + 2;
@@ -331,7 +310,7 @@ string get_dictionary(const string &buffer, size_t &offset)
         }
         if (c == '(' || c == '<')
         {
-            get_string(buffer, end_offset);
+            get_string_view(buffer, end_offset);
             continue;
         }
         if (c == '>' && c_next == '>')
@@ -350,10 +329,10 @@ string get_dictionary(const string &buffer, size_t &offset)
         ++end_offset;
     }
     if (end_offset >= buffer.length()) throw pdf_error(FUNC_STRING + "can`t find dictionary end delimiter");
-    return string(); //supress compiler warning
+    return boost::string_view(); //supress compiler warning
 }
 
-string get_name_object(const string &buffer, size_t &offset)
+boost::string_view get_name_object_view(boost::string_view buffer, size_t &offset)
 {
     size_t start_offset = offset;
     offset = find_name_end_delimiter(buffer, offset);
@@ -361,7 +340,7 @@ string get_name_object(const string &buffer, size_t &offset)
     return buffer.substr(start_offset, offset - start_offset);
 }
 
-string get_value(const string &buffer, size_t &offset)
+boost::string_view get_value_view(boost::string_view buffer, size_t &offset)
 {
     size_t start_offset = offset;
     offset = find_value_end_delimiter(buffer, offset);
@@ -369,7 +348,7 @@ string get_value(const string &buffer, size_t &offset)
     return buffer.substr(start_offset, offset - start_offset);
 }
 
-string get_indirect_object(const string &buffer, size_t &offset)
+boost::string_view get_indirect_object_view(boost::string_view buffer, size_t &offset)
 {
     size_t start_offset = offset;
     offset = efind(buffer, 'R', offset) + 1;
@@ -377,7 +356,7 @@ string get_indirect_object(const string &buffer, size_t &offset)
     return buffer.substr(start_offset, offset - start_offset);
 }
 
-string get_string(const string &buffer, size_t &offset)
+boost::string_view get_string_view(boost::string_view buffer, size_t &offset)
 {
     char delimiter = buffer.at(offset);
     if (delimiter != '(' && delimiter != '<') throw pdf_error(FUNC_STRING + "string must start with '(' or '<'");
@@ -414,44 +393,40 @@ string get_string(const string &buffer, size_t &offset)
     }
 }
 
-string decode_string(const string &str)
+string decode_string(boost::string_view str)
 {
-    return (str[0] == '<')? hex_decode(str) :  unescape_string(str);
+    return (str[0] == '<')? hex_decode(str.substr(1, str.length() - 2)) : unescape_string(str);
 }
 
-
-string get_array(const string &buffer, size_t &offset)
+boost::string_view get_array_view(boost::string_view buffer, size_t &offset)
 {
-    string result = "[";
+    size_t start_offset = offset;
     ++offset;
     unsigned int prevs = 0;
     while (true)
     {
-        switch (buffer[offset])
+        switch (buffer.at(offset))
         {
         case '(':
-            result += get_string(buffer, offset);
+            get_string_view(buffer, offset);
             continue;
             break;
         case '<':
-            result += buffer.at(offset + 1) == '<'? get_dictionary(buffer, offset) : get_string(buffer, offset);
+            buffer.at(offset + 1) == '<'? get_dictionary_view(buffer, offset) : get_string_view(buffer, offset);
             continue;
             break;
         case '[':
-            result.push_back(buffer.at(offset));
             ++prevs;
             break;
         case ']':
-            result.push_back(buffer.at(offset));
             if (!prevs)
             {
                 ++offset;
-                return result;
+                return buffer.substr(start_offset, offset - start_offset);
             }
             --prevs;
             break;
         default:
-            result.push_back(buffer.at(offset));
             break;
         }
         ++offset;
@@ -459,129 +434,95 @@ string get_array(const string &buffer, size_t &offset)
     throw pdf_error(FUNC_STRING + " no array in " + to_string(offset));
 }
 
-dict_t get_dictionary_data(const string &buffer, size_t offset)
+string get_dictionary(boost::string_view buffer, size_t &offset)
 {
-    offset = efind(buffer, "<<", offset);
-    offset += LEN("<<");
-    dict_t result;
-    while (true)
-    {
-        offset = skip_comments(buffer, offset);
-        if (buffer[offset] == '>' && buffer.at(offset + 1) == '>') return result;
-        if (buffer[offset] != '/') throw pdf_error(FUNC_STRING + "Can`t find name key");
-        size_t end_offset = efind_first(buffer, "\r\t\n /<[(", offset + 1);
-        const string key = buffer.substr(offset, end_offset - offset);
-        offset = end_offset;
-        pdf_object_t type = get_object_type(buffer, offset);
-        const string val = TYPE2FUNC.at(type)(buffer, offset);
-        result.emplace(key, make_pair(val, type));
-    }
+    return get_dictionary_view(buffer, offset).to_string();
 }
 
-array_t get_array_data(const string &buffer, size_t offset)
+string get_name_object(boost::string_view buffer, size_t &offset)
 {
-    offset = efind(buffer, '[', offset);
-    ++offset;
-    vector<pair<string, pdf_object_t>> result;
-    while (true)
-    {
-        offset = skip_comments(buffer, offset);
-        if (buffer.at(offset) == ']') return result;
-        pdf_object_t type = get_object_type(buffer, offset);
-        string val = TYPE2FUNC.at(type)(buffer, offset);
-        result.emplace_back(std::move(val), type);
-    }
-    return result;
+    return get_name_object_view(buffer, offset).to_string();
 }
 
-string predictor_decode(const string &data, const dict_t &opts)
+string get_value(boost::string_view buffer, size_t &offset)
 {
-    unsigned int predictor = get_decode_key(opts, "/Predictor", 1);
-    unsigned int colors = get_decode_key(opts, "/Colors", 1);
-    unsigned int BPCs = get_decode_key(opts, "/BitsPerComponent", 8);
-    unsigned int columns     = get_decode_key(opts, "/Columns", 1);
-    bool next_byte_is_predictor = predictor >= 10? true: false;
-    unsigned int cur_predictor = predictor >= 10? -1 : predictor;
-    int cur_row_index = 0;
-    int bpp  = (BPCs * colors) >> 3;
-    int rows = (columns * colors * BPCs) >> 3;
-    vector<char> prev(rows, 0);
+    return get_value_view(buffer, offset).to_string();
+}
 
-    if (predictor == 1) return data;
+string get_indirect_object(boost::string_view buffer, size_t &offset)
+{
+    return get_indirect_object_view(buffer, offset).to_string();
+}
 
-    const char *p_buffer = data.c_str();
-    size_t len = data.length();
-    string result;
-    while (len--)
+string get_string(boost::string_view buffer, size_t &offset)
+{
+    return get_string_view(buffer, offset).to_string();
+}
+
+string get_array(boost::string_view buffer, size_t &offset)
+{
+    return get_array_view(buffer, offset).to_string();
+}
+
+namespace
+{
+    //one lexing loop for owning and non-owning containers, tokens are converted to element type once
+    template <class T> T parse_dictionary_data(boost::string_view buffer, size_t offset)
     {
-        if (next_byte_is_predictor)
+        using key_t = typename T::key_type;
+        using value_t = typename T::mapped_type::first_type;
+        offset = efind(buffer, "<<", offset);
+        offset += LEN("<<");
+        T result;
+        while (true)
         {
-            cur_predictor = *p_buffer + 10;
-            next_byte_is_predictor = false;
+            offset = skip_comments(buffer, offset);
+            if (buffer[offset] == '>' && buffer.at(offset + 1) == '>') return result;
+            if (buffer[offset] != '/') throw pdf_error(FUNC_STRING + "Can`t find name key");
+            size_t end_offset = efind_first(buffer, "\r\t\n /<[(", offset + 1);
+            const key_t key(buffer.data() + offset, end_offset - offset);
+            offset = end_offset;
+            pdf_object_t type = get_object_type(buffer, offset);
+            boost::string_view val = TYPE2VIEWFUNC.at(type)(buffer, offset);
+            result.emplace(key, make_pair(value_t(val.data(), val.size()), type));
         }
-        else
-        {
-            switch (cur_predictor )
-            {
-            case 2: // Tiff Predictor
-            {
-                if (BPCs == 8)
-                {   // Same as png sub
-                    unsigned int prev_local = cur_row_index - bpp < 0 ? 0 : prev[cur_row_index - bpp];
-                    prev[cur_row_index] = *p_buffer + prev_local;
-                    break;
-                }
-
-                throw pdf_error(FUNC_STRING + "tiff predictor other than 8 BPC is not implemented");
-                break;
-            }
-            case 10: // png none
-            {
-                prev[cur_row_index] = *p_buffer;
-                break;
-            }
-            case 11: // png sub
-            {
-                unsigned int local_prev = cur_row_index - bpp < 0? 0 : prev[cur_row_index - bpp];
-                prev[cur_row_index] = *p_buffer + local_prev;
-                break;
-            }
-            case 12: // png up
-            {
-                prev[cur_row_index] += *p_buffer;
-                break;
-            }
-            case 13: // png average
-            {
-                int local_prev = cur_row_index - bpp < 0? 0 : prev[cur_row_index - bpp];
-                prev[cur_row_index] = ((local_prev + prev[cur_row_index]) >> 1) + *p_buffer;
-                break;
-            }
-            case 14: // png paeth
-            case 15: // png optimum
-            {
-                throw pdf_error(FUNC_STRING + "predictor " + to_string(cur_predictor) + " is invalid");
-                break;
-            }
-            default:
-            {
-                //    throw pdf_error(FUNC_STRING + "predictor " + to_string(cur_predictor) + " is invalid");
-                break;
-            }
-            }
-            ++cur_row_index;
-        }
-        ++p_buffer;
+    }
 
-        if (cur_row_index >= rows )
-        {   // One line finished
-            cur_row_index  = 0;
-            next_byte_is_predictor = (cur_predictor >= 10);
-            result.append(prev.data(), rows);
+    template <class T> T parse_array_data(boost::string_view buffer, size_t offset)
+    {
+        using value_t = typename T::value_type::first_type;
+        offset = efind(buffer, '[', offset);
+        ++offset;
+        T result;
+        while (true)
+        {
+            offset = skip_comments(buffer, offset);
+            if (buffer.at(offset) == ']') return result;
+            pdf_object_t type = get_object_type(buffer, offset);
+            boost::string_view val = TYPE2VIEWFUNC.at(type)(buffer, offset);
+            result.emplace_back(value_t(val.data(), val.size()), type);
         }
     }
+}
 
-    return result;
+dict_view_t get_dictionary_data_view(boost::string_view buffer, size_t offset)
+{
+    return parse_dictionary_data<dict_view_t>(buffer, offset);
+}
+
+dict_t get_dictionary_data(boost::string_view buffer, size_t offset)
+{
+    return parse_dictionary_data<dict_t>(buffer, offset);
+}
+
+array_view_t get_array_data_view(boost::string_view buffer, size_t offset)
+{
+    return parse_array_data<array_view_t>(buffer, offset);
+}
+
+array_t get_array_data(boost::string_view buffer, size_t offset)
+{
+    return parse_array_data<array_t>(buffer, offset);
 }
 
 size_t strict_stoul(const string &str, int base /*= 10*/)
@@ -639,78 +580,117 @@ vector<pair<unsigned int, unsigned int>> get_set(const string &array)
     return result;
 }
 
-pair<string, pdf_object_t> get_object(const string &buffer, size_t id, const map<size_t, size_t> &id2offsets)
+size_t get_object_offset(size_t id, const xref_t &xref)
+{
+    if (id >= xref.size() || xref[id].type != xref_entry_t::IN_USE)
+    {
+        throw pdf_error(FUNC_STRING + "object " + to_string(id) + " is not in use");
+    }
+    return xref[id].value;
+}
+
+pair<string, pdf_object_t> get_object(boost::string_view buffer, size_t id, const xref_t &xref)
 {
-    size_t offset = id2offsets.at(id);
+    size_t offset = get_object_offset(id, xref);
     offset = skip_comments(buffer, offset);
-    offset = efind(buffer, "obj", id2offsets.at(id));
+    offset = efind(buffer, "obj", offset);
     offset += LEN("obj");
     offset = skip_comments(buffer, offset);
     pdf_object_t type = get_object_type(buffer, offset);
     return make_pair(TYPE2FUNC.at(type)(buffer, offset), type);
 }
 
-string get_stream(const string &doc,
+string get_stream(boost::string_view doc,
                   const pair<unsigned int, unsigned int> &id_gen,
-                  const ObjectStorage &storage,
-                  const dict_t &decrypt_data)
-{
-    const pair<string, pdf_object_t> stream_pair = storage.get_object(id_gen.first);
-    if (stream_pair.second != DICTIONARY) throw pdf_error(FUNC_STRING + "stream must be a dictionary");
-    const dict_t props = get_dictionary_data(stream_pair.first, 0);
-    const map<size_t, size_t> &id2offsets = storage.get_id2offsets();
-    size_t offset = efind(doc, "<<", id2offsets.at(id_gen.first));
-    get_dictionary(doc, offset);
+                  const ObjectStorage &storage)
+{
+    const shared_ptr<const dict_t> props_ptr = storage.get_dict(id_gen.first);
+    const dict_t &props = *props_ptr;
+    if (!is_text_stream(props))
+    {
+        storage.skip_stream(id_gen.first, props);
+        return string();
+    }
+    size_t offset = efind(doc, "<<", storage.get_offset(id_gen.first));
+    get_dictionary_view(doc, offset);
     string content = get_content(doc, get_length(doc, storage, props), offset);
-    content = decrypt(id_gen.first, id_gen.second, content, decrypt_data);
+    storage.get_decryptor().decrypt(id_gen.first, id_gen.second, content);
 
-    return decode(content, props);
+    return decode(std::move(content), props);
 }
 
-string get_content(const string &buffer, size_t len, size_t offset)
+string get_content(boost::string_view buffer, size_t len, size_t offset)
 {
     offset = efind(buffer, "stream", offset);
     offset += LEN("stream");
-    if (buffer[offset] == '\r') ++offset;
-    if (buffer[offset] == '\n') ++offset;
-    return buffer.substr(offset, len);
+    if (offset < buffer.length() && buffer[offset] == '\r') ++offset;
+    if (offset < buffer.length() && buffer[offset] == '\n') ++offset;
+    return buffer.substr(offset, len).to_string();
 }
 
-string decode(const string &content, const dict_t &props)
+string decode(string &&content, const dict_t &props)
 {
-    if (!props.count("/Filter")) return content;
+    if (!props.count("/Filter")) return std::move(content);
     vector<string> filters = get_filters(props);
     vector<dict_t> decode_params = get_decode_params(props, filters.size());
     if (filters.size() != decode_params.size())
     {
         throw pdf_error(FUNC_STRING + "different sizes for filters and decode_params");
     }
-    string result = content;
-    for (size_t i = 0; i < filters.size(); ++i) result = FILTER2FUNC.at(filters[i])(result, decode_params[i]);
-    return result;
+    //7.3.8.2. /DL is length of fully decoded stream, so it is a size hint for the last filter only
+    auto dl = props.find("/DL");
+    if (dl != props.end() && !decode_params.empty()) decode_params.back().insert(*dl);
+    if (filters.empty()) return std::move(content);
+    if (filters.size() == 1) return get_filter(filters[0]).decode(content, decode_params[0]);
+    //intermediate results of chained filters are passed by chunks
+    return FilterChain(content, filters, decode_params).read_all();
+}
+
+bool is_text_stream(const dict_t &props)
+{
+    //8.9.5. image XObjects, thumbnails(12.3.4) can be without /Subtype but have /Width and /Height.
+    //8.8.2. PostScript XObjects, 14.3.2. metadata streams
+    auto it = props.find("/Subtype");
+    if (it != props.end() && (it->second.first == "/Image" || it->second.first == "/PS" || it->second.first == "/XML"))
+    {
+        return false;
+    }
+    if (props.count("/Width") && props.count("/Height")) return false;
+    it = props.find("/Type");
+    //7.11.4. embedded file streams
+    if (it != props.end() && (it->second.first == "/EmbeddedFile" || it->second.first == "/Metadata")) return false;
+    //8.6.5.5. ICC profile streams have only number of components. Object streams with /N have /Type
+    if (it == props.end() && props.count("/N")) return false;
+    //data of image only filters(e.g. DCTDecode) is image too
+    if (props.count("/Filter"))
+    {
+        const vector<string> filters = get_filters(props);
+        if (!filters.empty() && IMAGE_FILTERS.count(filters.back())) return false;
+    }
+    return true;
 }
 
-size_t find_number(const string &buffer, size_t offset)
+size_t find_number(boost::string_view buffer, size_t offset)
 {
     while (offset < buffer.length() && !isdigit(buffer[offset])) ++offset;
     return offset;
 }
 
-size_t efind_number(const string &buffer, size_t offset)
+size_t efind_number(boost::string_view buffer, size_t offset)
 {
     size_t result = find_number(buffer, offset);
     if (result >= buffer.length()) throw pdf_error(FUNC_STRING + "can`t find number");
     return result;
 }
 
-pair<unsigned int, unsigned int> get_id_gen(const string &data)
+pair<unsigned int, unsigned int> get_id_gen(boost::string_view data)
 {
     size_t offset = 0;
     size_t end_offset = efind_first(data, "\r\t\n ", offset);
-    unsigned int id = strict_stoul(data.substr(offset, end_offset - offset));
+    unsigned int id = strict_stoul(data.substr(offset, end_offset - offset).to_string());
     offset = efind_number(data, end_offset);
     end_offset = efind_first(data, "\r\t\n ", offset);
-    unsigned int gen = strict_stoul(data.substr(offset, end_offset - offset));
+    unsigned int gen = strict_stoul(data.substr(offset, end_offset - offset).to_string());
     return make_pair(id, gen);
 }
 
@@ -760,27 +740,28 @@ matrix_t operator*(const matrix_t &m1, const matrix_t &m2)
                     m2[1] * m1[4] + m2[3] * m1[5] + m2[5]};
 }
 
-dict_t get_dict_or_indirect_dict(const pair<string, pdf_object_t> &data, const ObjectStorage &storage)
+shared_ptr<const dict_t> get_dict_or_indirect_dict(const pair<string, pdf_object_t> &data, const ObjectStorage &storage)
 {
     switch (data.second)
     {
     case DICTIONARY:
-        return get_dictionary_data(data.first, 0);
+        return make_shared<const dict_t>(get_dictionary_data(data.first, 0));
     case INDIRECT_OBJECT:
-        return get_dictionary_data(get_indirect_object_data(data.first, storage, DICTIONARY).first, 0);
+        return storage.get_dict(get_id_gen(data.first).first);
     default:
         throw pdf_error(FUNC_STRING + "wrong object type " + to_string(data.second));
     }
 }
 
-array_t get_array_or_indirect_array(const pair<string, pdf_object_t> &data, const ObjectStorage &storage)
+shared_ptr<const array_t> get_array_or_indirect_array(const pair<string, pdf_object_t> &data,
+                                                      const ObjectStorage &storage)
 {
     switch (data.second)
     {
     case ARRAY:
-        return get_array_data(data.first, 0);
+        return make_shared<const array_t>(get_array_data(data.first, 0));
     case INDIRECT_OBJECT:
-        return get_array_data(get_indirect_object_data(data.first, storage, ARRAY).first, 0);
+        return storage.get_array(get_id_gen(data.first).first);
     default:
         throw pdf_error(FUNC_STRING + "wrong object type " + to_string(data.second));
     }
@@ -794,12 +775,12 @@ unsigned int string2num(const std::string &s)
     return result;
 }
 
-pair<string, pdf_object_t> get_content_len_pair(const string &buffer, size_t id, const map<size_t, size_t> &id2offsets)
+pair<string, pdf_object_t> get_content_len_pair(boost::string_view buffer, size_t id, const xref_t &xref)
 {
-    return get_object(buffer, id, id2offsets);
+    return get_object(buffer, id, xref);
 }
 
-pair<string, pdf_object_t> get_content_len_pair(const string &buffer, size_t id, const ObjectStorage &storage)
+pair<string, pdf_object_t> get_content_len_pair(boost::string_view buffer, size_t id, const ObjectStorage &storage)
 {
     return storage.get_object(id);
 }
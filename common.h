@@ -1,6 +1,7 @@
 #ifndef COMMON_H
 #define COMMON_H
 
+#include <cstdint>
 #include <string>
 #include <map>
 #include <stdexcept>
@@ -8,15 +9,18 @@
 #include <vector>
 #include <stack>
 #include <array>
+#include <memory>
 
 #include <boost/optional.hpp>
+#include <boost/utility/string_view.hpp>
 
 #define LEN(S) (sizeof(S) - 1)
 
 enum pdf_object_t { DICTIONARY = 1, ARRAY = 2, STRING = 3, VALUE = 4, INDIRECT_OBJECT = 5, NAME_OBJECT = 6 };
 
 #define FUNC_STRING (std::string(__func__) + ": ")
-extern const std::map<pdf_object_t, std::string (&)(const std::string&, size_t&)> TYPE2FUNC;
+extern const std::map<pdf_object_t, std::string (&)(boost::string_view, size_t&)> TYPE2FUNC;
+extern const std::map<pdf_object_t, boost::string_view (&)(boost::string_view, size_t&)> TYPE2VIEWFUNC;
 class ObjectStorage;
 
 class pdf_error : public std::runtime_error
@@ -33,73 +37,107 @@ public:
 
 using dict_t = std::map<std::string, std::pair<std::string, pdf_object_t>>;
 using array_t = std::vector<std::pair<std::string, pdf_object_t>>;
+//non-owning variants. Keys and values point into the parsed buffer, which must outlive them
+using dict_view_t = std::map<boost::string_view, std::pair<boost::string_view, pdf_object_t>>;
+using array_view_t = std::vector<std::pair<boost::string_view, pdf_object_t>>;
 using matrix_t = std::array<float, 6>;
 
+//7.5.4. Cross-Reference Table and 7.5.8.3. Cross-Reference Stream Data
+struct xref_entry_t
+{
+    enum type_t : uint8_t { FREE = 0, IN_USE = 1, COMPRESSED = 2 };
+
+    xref_entry_t() noexcept : value(0), gen(0), type(FREE)
+    {
+    }
+
+    xref_entry_t(type_t type_arg, size_t value_arg, uint16_t gen_arg = 0) noexcept :
+                 value(value_arg), gen(gen_arg), type(type_arg)
+    {
+    }
+
+    //index of COMPRESSED object inside object stream isn`t kept, all objects of the stream are loaded at once
+    size_t value; //byte offset for IN_USE object, object number of object stream for COMPRESSED object
+    uint16_t gen; //generation number for IN_USE object, always 0 for COMPRESSED object
+    type_t type;
+};
+static_assert(sizeof(xref_entry_t) <= 16, "xref_entry_t must stay packed");
+
+//cross-reference data indexed by object number
+using xref_t = std::vector<xref_entry_t>;
+
 extern const matrix_t IDENTITY_MATRIX;
 
-size_t efind_first(const std::string &src, const std::string& str, size_t pos);
-size_t efind_first(const std::string &src, const char* s, size_t pos);
-size_t efind_first(const std::string &src, const char* s, size_t pos, size_t n);
-size_t efind_first_not(const std::string &src, const std::string& str, size_t pos);
-size_t efind_first_not(const std::string &src, const char* s, size_t pos);
-size_t efind_first_not(const std::string &src, const char* s, size_t pos, size_t n);
-size_t efind(const std::string &src, const std::string& str, size_t pos);
-size_t efind(const std::string &src, const char* s, size_t pos);
-size_t efind(const std::string &src, char c, size_t pos);
-size_t skip_spaces(const std::string &buffer, size_t offset, bool validate = true);
-size_t skip_comments(const std::string &buffer, size_t offset, bool validate = true);
-pdf_object_t get_object_type(const std::string &buffer, size_t &offset);
-std::string get_value(const std::string &buffer, size_t &offset);
-std::string get_array(const std::string &buffer, size_t &offset);
-std::string get_name_object(const std::string &buffer, size_t &offset);
-std::string get_indirect_object(const std::string &buffer, size_t &offset);
-std::string get_string(const std::string &buffer, size_t &offset);
-std::string get_dictionary(const std::string &buffer, size_t &offset);
-std::string decode_string(const std::string &str);
+size_t efind_first(boost::string_view src, const std::string& str, size_t pos);
+size_t efind_first(boost::string_view src, const char* s, size_t pos);
+size_t efind_first(boost::string_view src, const char* s, size_t pos, size_t n);
+size_t efind_first_not(boost::string_view src, const std::string& str, size_t pos);
+size_t efind_first_not(boost::string_view src, const char* s, size_t pos);
+size_t efind_first_not(boost::string_view src, const char* s, size_t pos, size_t n);
+size_t efind(boost::string_view src, const std::string& str, size_t pos);
+size_t efind(boost::string_view src, const char* s, size_t pos);
+size_t efind(boost::string_view src, char c, size_t pos);
+size_t skip_spaces(boost::string_view buffer, size_t offset, bool validate = true);
+size_t skip_comments(boost::string_view buffer, size_t offset, bool validate = true);
+pdf_object_t get_object_type(boost::string_view buffer, size_t &offset);
+//zero-copy lexer. Returned views point into buffer
+boost::string_view get_value_view(boost::string_view buffer, size_t &offset);
+boost::string_view get_array_view(boost::string_view buffer, size_t &offset);
+boost::string_view get_name_object_view(boost::string_view buffer, size_t &offset);
+boost::string_view get_indirect_object_view(boost::string_view buffer, size_t &offset);
+boost::string_view get_string_view(boost::string_view buffer, size_t &offset);
+boost::string_view get_dictionary_view(boost::string_view buffer, size_t &offset);
+std::string get_value(boost::string_view buffer, size_t &offset);
+std::string get_array(boost::string_view buffer, size_t &offset);
+std::string get_name_object(boost::string_view buffer, size_t &offset);
+std::string get_indirect_object(boost::string_view buffer, size_t &offset);
+std::string get_string(boost::string_view buffer, size_t &offset);
+std::string get_dictionary(boost::string_view buffer, size_t &offset);
+std::string decode_string(boost::string_view str);
 size_t strict_stoul(const std::string &str, int base = 10);
 long int strict_stol(const std::string &str, int base = 10);
-std::string predictor_decode(const std::string &data, const dict_t &opts);
-dict_t get_dictionary_data(const std::string &buffer, size_t offset);
+dict_t get_dictionary_data(boost::string_view buffer, size_t offset);
+dict_view_t get_dictionary_data_view(boost::string_view buffer, size_t offset);
 std::vector<std::pair<unsigned int, unsigned int>> get_set(const std::string &array);
-std::pair<std::string, pdf_object_t> get_object(const std::string &buffer,
-                                                size_t id,
-                                                const std::map<size_t, size_t> &id2offsets);
-std::string get_stream(const std::string &doc,
+size_t get_object_offset(size_t id, const xref_t &xref);
+std::pair<std::string, pdf_object_t> get_object(boost::string_view buffer, size_t id, const xref_t &xref);
+std::string get_stream(boost::string_view doc,
                        const std::pair<unsigned int, unsigned int> &id_gen,
-                       const ObjectStorage &storage,
-                       const dict_t &encrypt_data);
-std::string get_content(const std::string &buffer, size_t len, size_t offset);
-std::string decode(const std::string &content, const dict_t &props);
-size_t find_number(const std::string &buffer, size_t offset);
-size_t efind_number(const std::string &buffer, size_t offset);
-size_t get_length(const std::string &buffer,
-                  const std::map<size_t, size_t> &id2offsets,
-                  const dict_t &props);
-std::pair<unsigned int, unsigned int> get_id_gen(const std::string &data);
+                       const ObjectStorage &storage);
+std::string get_content(boost::string_view buffer, size_t len, size_t offset);
+//content isn`t copied if it isn`t encoded, otherwise it is input of the first filter
+std::string decode(std::string &&content, const dict_t &props);
+//streams which can`t contain text(images, ICC profiles, embedded files, metadata) aren`t decrypted and decoded
+bool is_text_stream(const dict_t &props);
+size_t find_number(boost::string_view buffer, size_t offset);
+size_t efind_number(boost::string_view buffer, size_t offset);
+std::pair<unsigned int, unsigned int> get_id_gen(boost::string_view data);
 std::pair<std::string, pdf_object_t> get_indirect_object_data(const std::string &indirect_object,
                                                               const ObjectStorage &storage,
                                                               boost::optional<pdf_object_t> type = boost::none);
-array_t get_array_data(const std::string &buffer, size_t offset);
+array_t get_array_data(boost::string_view buffer, size_t offset);
+array_view_t get_array_data_view(boost::string_view buffer, size_t offset);
 std::pair<float, float> apply_matrix_norm(const matrix_t &matrix, float x, float y);
 unsigned int get_dict_val(const dict_t &dict, const std::string &key, unsigned int def);
 float get_dict_val(const dict_t &dict, const std::string &key, float def);
 size_t utf8_length(const std::string &s);
 matrix_t operator*(const matrix_t &m1, const matrix_t &m2);
-dict_t get_dict_or_indirect_dict(const std::pair<std::string, pdf_object_t> &data, const ObjectStorage &storage);
-array_t get_array_or_indirect_array(const std::pair<std::string, pdf_object_t> &data, const ObjectStorage &storage);
+//indirect objects are shared with the object cache of storage, so they aren`t copied
+std::shared_ptr<const dict_t> get_dict_or_indirect_dict(const std::pair<std::string, pdf_object_t> &data,
+                                                        const ObjectStorage &storage);
+std::shared_ptr<const array_t> get_array_or_indirect_array(const std::pair<std::string, pdf_object_t> &data,
+                                                           const ObjectStorage &storage);
 unsigned int string2num(const std::string &s);
 std::string num2string(unsigned int n);
 
-std::pair<std::string, pdf_object_t> get_content_len_pair(const std::string &buffer,
-                                                          size_t id,
-                                                          const std::map<size_t, size_t> &id2offsets);
-std::pair<std::string, pdf_object_t> get_content_len_pair(const std::string &buffer,
+std::pair<std::string, pdf_object_t> get_content_len_pair(boost::string_view buffer, size_t id, const xref_t &xref);
+std::pair<std::string, pdf_object_t> get_content_len_pair(boost::string_view buffer,
                                                           size_t id,
                                                           const ObjectStorage &storage);
 bool is_blank(char c);
 std::string get_token(const std::string &page_content, size_t &i);
 
-template <class T> size_t get_length(const std::string &buffer, const T &storage, const dict_t &props)
+template <class T> size_t get_length(boost::string_view buffer, const T &storage, const dict_t &props)
 {
     const std::pair<std::string, pdf_object_t> &r = props.at("/Length");
     if (r.second == VALUE)
@@ -0,0 +1,384 @@
+#include <string>
+#include <array>
+#include <cstdlib>
+#include <cstdint>
+
+#include "common.h"
+#include "content_lexer.h"
+#include "simd.h"
+
+using namespace std;
+
+namespace
+{
+    enum { REGULAR_CHAR = 0, WHITE_CHAR = 1, DELIMITER_CHAR = 2 };
+    //float keeps integers up to 2^24 and powers of 10 up to 10^10 exactly
+    enum { MAX_EXACT_MANTISSA = 1 << 24, MAX_EXACT_POWER = 10 };
+    const float POWERS10[MAX_EXACT_POWER + 1] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+
+    //7.2.2. Character Set
+    array<unsigned char, 256> make_char_table()
+    {
+        array<unsigned char, 256> result;
+        result.fill(REGULAR_CHAR);
+        for (unsigned char c : {0x00, 0x09, 0x0A, 0x0C, 0x0D, 0x20}) result[c] = WHITE_CHAR;
+        for (unsigned char c : {'(', ')', '<', '>', '[', ']', '{', '}', '/', '%'}) result[c] = DELIMITER_CHAR;
+        return result;
+    }
+
+    const array<unsigned char, 256> CHAR_TABLE = make_char_table();
+
+    unsigned char get_char_type(char c)
+    {
+        return CHAR_TABLE[static_cast<unsigned char>(c)];
+    }
+
+    bool is_number_start(char c)
+    {
+        return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.';
+    }
+
+    //7.3.3. Numeric Objects. Exact mantissa divided by exact power of 10 is rounded once, so the result is
+    //the same as strtof gives. Longer numbers and malformed tokens are passed to strtof
+    float get_number(boost::string_view token)
+    {
+        size_t i = 0;
+        bool negative = false;
+        if (token[0] == '-' || token[0] == '+')
+        {
+            negative = token[0] == '-';
+            ++i;
+        }
+        uint32_t mantissa = 0;
+        int power = -1;
+        bool has_digits = false;
+        for (; i < token.length(); ++i)
+        {
+            char c = token[i];
+            if (c == '.' && power < 0)
+            {
+                power = 0;
+                continue;
+            }
+            if (c < '0' || c > '9') break;
+            mantissa = mantissa * 10 + (c - '0');
+            has_digits = true;
+            if (power >= 0) ++power;
+            if (mantissa >= MAX_EXACT_MANTISSA || power > MAX_EXACT_POWER) break;
+        }
+        if (i == token.length() && has_digits)
+        {
+            float result = static_cast<float>(mantissa) / POWERS10[power < 0? 0 : power];
+            return negative? -result : result;
+        }
+        return strtof(token.to_string().c_str(), nullptr);
+    }
+
+    size_t find_regular_end(boost::string_view content, size_t offset)
+    {
+        while (offset < content.length() && get_char_type(content[offset]) == REGULAR_CHAR) ++offset;
+        return offset;
+    }
+
+    size_t skip_white_and_comments(boost::string_view content, size_t offset)
+    {
+        while (offset < content.length())
+        {
+            unsigned char type = get_char_type(content[offset]);
+            if (type == WHITE_CHAR)
+            {
+                ++offset;
+                continue;
+            }
+            if (content[offset] != '%') break;
+            offset = content.find_first_of("\r\n", offset);
+            if (offset == boost::string_view::npos) return content.length();
+        }
+        return offset;
+    }
+
+    //bytes where skimming stops: first bytes of BT, BI, Do, cm, Tf, q and Q, or of operands which can hide them
+    bool is_skim_candidate(const char *data, size_t i, size_t len)
+    {
+        char next = (i + 1 < len)? data[i + 1] : 0;
+        switch (data[i])
+        {
+        case 'q': case 'Q': case '%': case '(': case '<': case '[':
+            return true;
+        case 'B':
+            return next == 'T' || next == 'I';
+        case 'D':
+            return next == 'o';
+        case 'c':
+            return next == 'm';
+        case 'T':
+            return next == 'f';
+        default:
+            return false;
+        }
+    }
+
+    //kernel returns offset of the first candidate or of the tail which it can`t check
+    typedef size_t (*skim_kernel_t)(const char *data, size_t len);
+
+#ifdef PDF_EXTRACTOR_X86_SIMD
+    //two-byte operators are matched by comparing every byte and its successor
+    size_t skim_kernel_sse2(const char *data, size_t len)
+    {
+        size_t i = 0;
+        for (; i + 17 <= len; i += 16)
+        {
+            __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            __m128i next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 1));
+            __m128i single = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('q')),
+                                                       _mm_cmpeq_epi8(c, _mm_set1_epi8('Q'))),
+                                          _mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('%')),
+                                                       _mm_cmpeq_epi8(c, _mm_set1_epi8('('))));
+            single = _mm_or_si128(single, _mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('<')),
+                                                       _mm_cmpeq_epi8(c, _mm_set1_epi8('['))));
+            __m128i B = _mm_and_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('B')),
+                                      _mm_or_si128(_mm_cmpeq_epi8(next, _mm_set1_epi8('T')),
+                                                   _mm_cmpeq_epi8(next, _mm_set1_epi8('I'))));
+            __m128i Do = _mm_and_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('D')), _mm_cmpeq_epi8(next, _mm_set1_epi8('o')));
+            __m128i cm = _mm_and_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('c')), _mm_cmpeq_epi8(next, _mm_set1_epi8('m')));
+            __m128i Tf = _mm_and_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('T')), _mm_cmpeq_epi8(next, _mm_set1_epi8('f')));
+            int mask = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(single, B), _mm_or_si128(_mm_or_si128(Do, cm), Tf)));
+            if (mask) return i + __builtin_ctz(mask);
+        }
+        return i;
+    }
+
+    skim_kernel_t get_skim_kernel()
+    {
+        return skim_kernel_sse2;
+    }
+#else
+    skim_kernel_t get_skim_kernel()
+    {
+        return nullptr;
+    }
+#endif
+
+    const skim_kernel_t SKIM_KERNEL = get_skim_kernel();
+
+    size_t find_skim_candidate(boost::string_view content, size_t offset)
+    {
+        const char *data = content.data();
+        size_t len = content.length();
+        if (SKIM_KERNEL)
+        {
+            offset += SKIM_KERNEL(data + offset, len - offset);
+            if (offset < len && is_skim_candidate(data, offset, len)) return offset;
+        }
+        while (offset < len && !is_skim_candidate(data, offset, len)) ++offset;
+        return offset;
+    }
+
+    size_t get_skim_operands_num(content_operator_t op)
+    {
+        switch (op)
+        {
+        case OP_cm:
+            return 6;
+        case OP_Tf:
+            return 2;
+        case OP_Do:
+            return 1;
+        default:
+            return 0;
+        }
+    }
+
+    //operands of operators where skimming stops are numbers and names, so they are found backwards up to start
+    size_t find_operands_start(boost::string_view content, size_t start, size_t offset, size_t operands_num)
+    {
+        for (size_t i = 0; i < operands_num; ++i)
+        {
+            size_t j = offset;
+            while (j > start && get_char_type(content[j - 1]) == WHITE_CHAR) --j;
+            size_t end = j;
+            while (j > start && get_char_type(content[j - 1]) == REGULAR_CHAR) --j;
+            if (j > start && content[j - 1] == '/') --j;
+            if (j == end) break;
+            offset = j;
+        }
+        return offset;
+    }
+
+    struct operator_name_t
+    {
+        const char *name;
+        content_operator_t op;
+    };
+
+    constexpr operator_name_t OPERATOR_NAMES[] = {
+        {"w", OP_w}, {"J", OP_J}, {"j", OP_j}, {"M", OP_M}, {"d", OP_d}, {"ri", OP_ri}, {"i", OP_i}, {"gs", OP_gs},
+        {"q", OP_q}, {"Q", OP_Q}, {"cm", OP_cm},
+        {"m", OP_m}, {"l", OP_l}, {"c", OP_c}, {"v", OP_v}, {"y", OP_y}, {"h", OP_h}, {"re", OP_re},
+        {"S", OP_S}, {"s", OP_s}, {"f", OP_f}, {"F", OP_F}, {"f*", OP_f_star}, {"B", OP_B}, {"B*", OP_B_star},
+        {"b", OP_b}, {"b*", OP_b_star}, {"n", OP_n},
+        {"W", OP_W}, {"W*", OP_W_star},
+        {"BT", OP_BT}, {"ET", OP_ET},
+        {"Tc", OP_Tc}, {"Tw", OP_Tw}, {"Tz", OP_Tz}, {"TL", OP_TL}, {"Tf", OP_Tf}, {"Tr", OP_Tr}, {"Ts", OP_Ts},
+        {"Td", OP_Td}, {"TD", OP_TD}, {"Tm", OP_Tm}, {"T*", OP_T_star},
+        {"Tj", OP_Tj}, {"TJ", OP_TJ}, {"'", OP_quote}, {"\"", OP_double_quote},
+        {"d0", OP_d0}, {"d1", OP_d1},
+        {"CS", OP_CS}, {"cs", OP_cs}, {"SC", OP_SC}, {"SCN", OP_SCN}, {"sc", OP_sc}, {"scn", OP_scn},
+        {"G", OP_G}, {"g", OP_g}, {"RG", OP_RG}, {"rg", OP_rg}, {"K", OP_K}, {"k", OP_k},
+        {"sh", OP_sh},
+        {"BI", OP_BI}, {"ID", OP_ID}, {"EI", OP_EI},
+        {"Do", OP_Do},
+        {"MP", OP_MP}, {"DP", OP_DP}, {"BMC", OP_BMC}, {"BDC", OP_BDC}, {"EMC", OP_EMC},
+        {"BX", OP_BX}, {"EX", OP_EX}};
+    enum
+    {
+        OPERATOR_NAMES_NUM = sizeof(OPERATOR_NAMES) / sizeof(OPERATOR_NAMES[0]),
+        MAX_OPERATOR_LEN = 3,
+        OPERATOR_HASH_BITS = 8,
+        OPERATOR_SLOTS_NUM = 1 << OPERATOR_HASH_BITS
+    };
+    //the first odd number after 2^32 / golden ratio which maps all operators to different slots
+    constexpr uint32_t OPERATOR_HASH_MULTIPLIER = 0x9E3C5CB3;
+
+    //operator bytes in little endian order, operators don`t contain 0 bytes, so keys of different lengths differ
+    constexpr uint32_t get_operator_key(const char *name)
+    {
+        return name[0] == 0? 0 : static_cast<uint32_t>(static_cast<unsigned char>(name[0])) | get_operator_key(name + 1) << 8;
+    }
+
+    constexpr uint32_t hash_operator(uint32_t key)
+    {
+        return static_cast<uint32_t>(key * OPERATOR_HASH_MULTIPLIER) >> (32 - OPERATOR_HASH_BITS);
+    }
+
+    //empty slot has key 0, which can`t be a key of a token
+    struct operator_slot_t
+    {
+        uint32_t key;
+        content_operator_t op;
+    };
+
+    constexpr operator_slot_t find_operator_slot(uint32_t slot, size_t i)
+    {
+        return i == OPERATOR_NAMES_NUM? operator_slot_t{0, OP_UNKNOWN} :
+               hash_operator(get_operator_key(OPERATOR_NAMES[i].name)) == slot?
+                   operator_slot_t{get_operator_key(OPERATOR_NAMES[i].name), OPERATOR_NAMES[i].op} :
+                   find_operator_slot(slot, i + 1);
+    }
+
+    //every operator is found in its slot, so hash has no collisions
+    constexpr bool is_perfect_hash(size_t i)
+    {
+        return i == OPERATOR_NAMES_NUM ||
+               (find_operator_slot(hash_operator(get_operator_key(OPERATOR_NAMES[i].name)), 0).op == OPERATOR_NAMES[i].op &&
+                is_perfect_hash(i + 1));
+    }
+    static_assert(is_perfect_hash(0), "OPERATOR_HASH_MULTIPLIER gives collisions");
+    static_assert(OPERATOR_NAMES_NUM == OP_EX - OP_w + 1, "every operator must have a name");
+
+    template <size_t... I> struct indices_t
+    {
+    };
+
+    template <size_t N, size_t... I> struct make_indices_t : make_indices_t<N - 1, N - 1, I...>
+    {
+    };
+
+    template <size_t... I> struct make_indices_t<0, I...>
+    {
+        using type = indices_t<I...>;
+    };
+
+    template <size_t... I> constexpr array<operator_slot_t, sizeof...(I)> make_operator_slots(indices_t<I...>)
+    {
+        return array<operator_slot_t, sizeof...(I)>{{find_operator_slot(I, 0)...}};
+    }
+
+    //generated at compile time
+    constexpr array<operator_slot_t, OPERATOR_SLOTS_NUM> OPERATOR_SLOTS =
+        make_operator_slots(make_indices_t<OPERATOR_SLOTS_NUM>::type());
+
+    content_token_t make_operand(pdf_object_t type, boost::string_view data, float number = 0)
+    {
+        content_token_t token;
+        token.op = OP_NONE;
+        token.operand.type = type;
+        token.operand.data = data;
+        token.operand.number = number;
+        return token;
+    }
+
+    content_token_t make_operator(content_operator_t op)
+    {
+        content_token_t token;
+        token.op = op;
+        return token;
+    }
+}
+
+content_operator_t get_content_operator(boost::string_view token)
+{
+    if (token.length() > MAX_OPERATOR_LEN) return OP_UNKNOWN;
+    uint32_t key = 0;
+    for (size_t i = 0; i < token.length(); ++i) key |= static_cast<uint32_t>(static_cast<unsigned char>(token[i])) << (8 * i);
+    const operator_slot_t &slot = OPERATOR_SLOTS[hash_operator(key)];
+    return slot.key == key? slot.op : OP_UNKNOWN;
+}
+
+content_token_t get_content_token(boost::string_view content, size_t &offset)
+{
+    offset = skip_white_and_comments(content, offset);
+    if (offset == content.length()) return make_operator(OP_END);
+    size_t start = offset;
+    switch (content[offset])
+    {
+    case '(':
+        return make_operand(STRING, get_string_view(content, offset));
+    case '<':
+        if (content.at(offset + 1) == '<') return make_operand(DICTIONARY, get_dictionary_view(content, offset));
+        return make_operand(STRING, get_string_view(content, offset));
+    case '[':
+        return make_operand(ARRAY, get_array_view(content, offset));
+    case '/':
+        offset = find_regular_end(content, offset + 1);
+        return make_operand(NAME_OBJECT, content.substr(start, offset - start));
+    default:
+        break;
+    }
+    //unbalanced closing delimiters are skipped as unknown operators
+    if (get_char_type(content[offset]) == DELIMITER_CHAR)
+    {
+        ++offset;
+        return make_operator(OP_UNKNOWN);
+    }
+    offset = find_regular_end(content, offset);
+    boost::string_view token = content.substr(start, offset - start);
+    if (is_number_start(token[0])) return make_operand(VALUE, token, get_number(token));
+    return make_operator(get_content_operator(token));
+}
+
+size_t skim_graphics(boost::string_view content, size_t offset)
+{
+    size_t start = offset;
+    while (true)
+    {
+        offset = find_skim_candidate(content, offset);
+        if (offset == content.length()) return offset;
+        if (get_char_type(content[offset]) == DELIMITER_CHAR) return offset;
+        //the candidate must be a whole token and not a part of a name or another operator
+        bool is_token_start = offset == 0 || get_char_type(content[offset - 1]) == WHITE_CHAR ||
+                              (get_char_type(content[offset - 1]) == DELIMITER_CHAR && content[offset - 1] != '/');
+        size_t end = find_regular_end(content, offset);
+        content_operator_t op = get_content_operator(content.substr(offset, end - offset));
+        //first bytes of candidates match only BT, BI, Do, cm, Tf, q and Q
+        if (is_token_start && op != OP_UNKNOWN) return find_operands_start(content, start, offset, get_skim_operands_num(op));
+        offset = end;
+    }
+}
+
+float pop_number(operand_stack_t &st)
+{
+    const operand_t operand = st.pop();
+    if (operand.type != VALUE) throw pdf_error(FUNC_STRING + "operand " + operand.data.to_string() + " is not number");
+    return operand.number;
+}
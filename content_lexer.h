@@ -0,0 +1,109 @@
+#ifndef CONTENT_LEXER_H
+#define CONTENT_LEXER_H
+
+#include <algorithm>
+
+#include <boost/utility/string_view.hpp>
+
+#include "common.h"
+
+//7.8.2. Content Streams. Table 51 – Operator Categories, tokens which aren`t operands or operators are OP_UNKNOWN
+enum content_operator_t
+{
+    OP_NONE = 0, //token is operand
+    OP_UNKNOWN,
+    //general graphics state
+    OP_w, OP_J, OP_j, OP_M, OP_d, OP_ri, OP_i, OP_gs,
+    //special graphics state
+    OP_q, OP_Q, OP_cm,
+    //path construction
+    OP_m, OP_l, OP_c, OP_v, OP_y, OP_h, OP_re,
+    //path painting
+    OP_S, OP_s, OP_f, OP_F, OP_f_star, OP_B, OP_B_star, OP_b, OP_b_star, OP_n,
+    //clipping paths
+    OP_W, OP_W_star,
+    //text objects
+    OP_BT, OP_ET,
+    //text state
+    OP_Tc, OP_Tw, OP_Tz, OP_TL, OP_Tf, OP_Tr, OP_Ts,
+    //text positioning
+    OP_Td, OP_TD, OP_Tm, OP_T_star,
+    //text showing
+    OP_Tj, OP_TJ, OP_quote, OP_double_quote,
+    //Type 3 fonts
+    OP_d0, OP_d1,
+    //color
+    OP_CS, OP_cs, OP_SC, OP_SCN, OP_sc, OP_scn, OP_G, OP_g, OP_RG, OP_rg, OP_K, OP_k,
+    //shading patterns
+    OP_sh,
+    //inline images
+    OP_BI, OP_ID, OP_EI,
+    //XObjects
+    OP_Do,
+    //marked content
+    OP_MP, OP_DP, OP_BMC, OP_BDC, OP_EMC,
+    //compatibility
+    OP_BX, OP_EX,
+    OP_END, //end of content
+    CONTENT_OPERATORS_NUM
+};
+
+//data points into content stream, number is set only for VALUE operands
+struct operand_t
+{
+    boost::string_view data;
+    float number;
+    pdf_object_t type;
+};
+
+struct content_token_t
+{
+    operand_t operand; //valid if op is OP_NONE
+    content_operator_t op;
+};
+
+//every operator consumes all operands before it, so the stack holds operands of one operator.
+//scn with 32 DeviceN colorants has the most of them, extra operands of broken content replace the oldest ones
+struct operand_stack_t
+{
+    operand_stack_t() : size(0)
+    {
+    }
+
+    void push(const operand_t &operand)
+    {
+        if (size == MAX_OPERANDS)
+        {
+            std::copy(operands + 1, operands + MAX_OPERANDS, operands);
+            --size;
+        }
+        operands[size++] = operand;
+    }
+
+    operand_t pop()
+    {
+        if (size == 0) throw pdf_error(FUNC_STRING + "stack is empty");
+        return operands[--size];
+    }
+
+    void clear()
+    {
+        size = 0;
+    }
+
+    enum { MAX_OPERANDS = 64 };
+    operand_t operands[MAX_OPERANDS];
+    size_t size;
+};
+
+//reads token after white-spaces and comments and moves offset past it.
+//Strings, arrays and dictionaries are single operands, numbers are parsed once here
+content_token_t get_content_token(boost::string_view content, size_t &offset);
+//outside text objects only BT, BI, Do, cm, Tf, q and Q change extraction state, other graphics are skipped.
+//Returns offset of operands of the next such operator or of the next string, array, dictionary or comment,
+//which can contain the same bytes
+size_t skim_graphics(boost::string_view content, size_t offset);
+content_operator_t get_content_operator(boost::string_view token);
+float pop_number(operand_stack_t &st);
+
+#endif //CONTENT_LEXER_H
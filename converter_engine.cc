@@ -8,6 +8,7 @@
 #include "coordinates.h"
 #include "fonts.h"
 #include "common.h"
+#include "content_lexer.h"
 
 using namespace std;
 
@@ -64,30 +65,33 @@ text_chunk_t ConverterEngine::get_string(const string &s, Coordinates &coordinat
     return coordinates.adjust_coordinates(std::move(decoded), len, decoded_width, Tj, fonts);
 }
 
-vector<text_chunk_t> ConverterEngine::get_strings_from_array(const string &array,
+vector<text_chunk_t> ConverterEngine::get_strings_from_array(boost::string_view array,
                                                              Coordinates &coordinates,
                                                              const Fonts &fonts) const
 {
     vector<text_chunk_t> result;
     float Tj = 0;
-    array_t array_data = get_array_data(array, 0);
-    result.reserve(array_data.size());
-    for (const array_t::value_type &p : array_data)
+    //array is read by content lexer, so numbers are parsed once and strings aren`t copied
+    size_t offset = 1;
+    for (content_token_t token = get_content_token(array, offset);
+         token.op == OP_NONE;
+         token = get_content_token(array, offset))
     {
-        switch (p.second)
+        switch (token.operand.type)
         {
         case VALUE:
-            Tj = stof(p.first);
+            Tj = token.operand.number;
             break;
         case STRING:
         {
-            text_chunk_t chunk = get_string(decode_string(p.first), coordinates, Tj, fonts);
+            text_chunk_t chunk = get_string(decode_string(token.operand.data), coordinates, Tj, fonts);
             if (!chunk.is_empty) result.push_back(std::move(chunk));
             Tj = 0;
             break;
         }
         default:
-            throw pdf_error(FUNC_STRING + "wrong type " + to_string(p.second) + " val=" + p.first);
+            throw pdf_error(FUNC_STRING + "wrong type " + to_string(token.operand.type) +
+                            " val=" + token.operand.data.to_string());
         }
     }
     return result;
@@ -3,6 +3,8 @@
 
 #include <string>
 
+#include <boost/utility/string_view.hpp>
+
 #include "charset_converter.h"
 #include "diff_converter.h"
 #include "to_unicode_converter.h"
@@ -18,7 +20,7 @@ public:
     ConverterEngine() = default;
     bool is_vertical() const;
     text_chunk_t get_string(const std::string &s, Coordinates &coordinates, float Tj, const Fonts &fonts) const;
-    std::vector<text_chunk_t> get_strings_from_array(const std::string &array,
+    std::vector<text_chunk_t> get_strings_from_array(boost::string_view array,
                                                      Coordinates &coordinates,
                                                      const Fonts &fonts) const;
 
@@ -5,6 +5,7 @@
 #include "coordinates.h"
 #include "common.h"
 #include "fonts.h"
+#include "content_lexer.h"
 
 using namespace std;
 
@@ -15,14 +16,14 @@ namespace
         return matrix_t{m[0], m[1], m[2], m[3], x * m[0] + y * m[2] + m[4], x * m[1] + y * m[3] + m[5]};
     }
 
-    matrix_t get_matrix(vector<pair<pdf_object_t, string>> &st)
+    matrix_t get_matrix(operand_stack_t &st)
     {
-        float f = stof(pop(st).second);
-        float e = stof(pop(st).second);
-        float d = stof(pop(st).second);
-        float c = stof(pop(st).second);
-        float b = stof(pop(st).second);
-        float a = stof(pop(st).second);
+        float f = pop_number(st);
+        float e = pop_number(st);
+        float d = pop_number(st);
+        float c = pop_number(st);
+        float b = pop_number(st);
+        float a = pop_number(st);
         return matrix_t{a, b, c, d, e, f};
     }
 }
@@ -95,82 +96,82 @@ text_chunk_t Coordinates::adjust_coordinates(string &&s, size_t len, float width
     return text_chunk_t(std::move(s), coordinates_t(x0, y0, x1, y1));
 }
 
-void Coordinates::do_cm(vector<pair<pdf_object_t, string>> &st)
+void Coordinates::do_cm(operand_stack_t &st)
 {
     CTM = get_matrix(st) * CTM;
 }
 
-void Coordinates::do_q(vector<pair<pdf_object_t, string>> &st)
+void Coordinates::do_q(operand_stack_t &st)
 {
     CTMs.push(CTM);
 }
 
-void Coordinates::do_Q(vector<pair<pdf_object_t, string>> &st)
+void Coordinates::do_Q(operand_stack_t &st)
 {
     if (!CTMs.empty()) CTM = pop(CTMs);
 }
 
-void Coordinates::set_Tz(vector<pair<pdf_object_t, string>> &st)
+void Coordinates::set_Tz(operand_stack_t &st)
 {
     //Th in percentages
-    Th = stof(pop(st).second) / 100;
+    Th = pop_number(st) / 100;
 }
 
-void Coordinates::set_TL(vector<pair<pdf_object_t, string>> &st)
+void Coordinates::set_TL(operand_stack_t &st)
 {
-    TL = stof(pop(st).second);
+    TL = pop_number(st);
 }
 
-void Coordinates::set_Tc(vector<pair<pdf_object_t, string>> &st)
+void Coordinates::set_Tc(operand_stack_t &st)
 {
-    Tc = stof(pop(st).second);
+    Tc = pop_number(st);
 }
 
-void Coordinates::set_Tw(vector<pair<pdf_object_t, string>> &st)
+void Coordinates::set_Tw(operand_stack_t &st)
 {
-    Tw = stof(pop(st).second);
+    Tw = pop_number(st);
 }
 
-void Coordinates::set_Td(vector<pair<pdf_object_t, string>> &st)
+void Coordinates::set_Td(operand_stack_t &st)
 {
-        float y = stof(pop(st).second);
-        float x = stof(pop(st).second);
+        float y = pop_number(st);
+        float x = pop_number(st);
         Td(x, y);
 }
 
-void Coordinates::set_TD(vector<pair<pdf_object_t, string>> &st)
+void Coordinates::set_TD(operand_stack_t &st)
 {
-    float y = stof(pop(st).second);
-    float x = stof(pop(st).second);
+    float y = pop_number(st);
+    float x = pop_number(st);
     Td(x, y);
     TL = -y;
 }
 
-void Coordinates::set_Tm(vector<pair<pdf_object_t, string>> &st)
+void Coordinates::set_Tm(operand_stack_t &st)
 {
     Tm = get_matrix(st);
     x = 0;
     y = 0;
 }
 
-void Coordinates::set_T_star(vector<pair<pdf_object_t, string>> &st)
+void Coordinates::set_T_star(operand_stack_t &st)
 {
     Td(0, -TL);
 }
 
-void Coordinates::set_Tf(vector<pair<pdf_object_t, string>> &st)
+void Coordinates::set_Tf(operand_stack_t &st)
 {
-    Tfs = stof(pop(st).second);
+    Tfs = pop_number(st);
 }
 
-void Coordinates::set_quote(vector<pair<pdf_object_t, string>> &st)
+void Coordinates::set_quote(operand_stack_t &st)
 {
     set_T_star(st);
 }
 
-void Coordinates::set_double_quote(vector<pair<pdf_object_t, string>> &st)
+void Coordinates::set_double_quote(operand_stack_t &st)
 {
-    Tc = stof(pop(st).second);
-    Tw = stof(pop(st).second);
+    Tc = pop_number(st);
+    Tw = pop_number(st);
     set_quote(st);
 }
@@ -7,6 +7,7 @@
 
 #include "common.h"
 #include "fonts.h"
+#include "content_lexer.h"
 
 struct coordinates_t
 {
@@ -118,20 +119,20 @@ public:
     void set_default();
     matrix_t get_CTM() const;
     text_chunk_t adjust_coordinates(std::string &&s, size_t len, float width, float Tj, const Fonts &fonts);
-    void do_cm(std::vector<std::pair<pdf_object_t, std::string>> &st);
-    void do_q(std::vector<std::pair<pdf_object_t, std::string>> &st);
-    void do_Q(std::vector<std::pair<pdf_object_t, std::string>> &st);
-    void set_Tz(std::vector<std::pair<pdf_object_t, std::string>> &st);
-    void set_TL(std::vector<std::pair<pdf_object_t, std::string>> &st);
-    void set_Tc(std::vector<std::pair<pdf_object_t, std::string>> &st);
-    void set_Tw(std::vector<std::pair<pdf_object_t, std::string>> &st);
-    void set_Td(std::vector<std::pair<pdf_object_t, std::string>> &st);
-    void set_TD(std::vector<std::pair<pdf_object_t, std::string>> &st);
-    void set_Tm(std::vector<std::pair<pdf_object_t, std::string>> &st);
-    void set_T_star(std::vector<std::pair<pdf_object_t, std::string>> &st);
-    void set_Tf(std::vector<std::pair<pdf_object_t, std::string>> &st);
-    void set_quote(std::vector<std::pair<pdf_object_t, std::string>> &st);
-    void set_double_quote(std::vector<std::pair<pdf_object_t, std::string>> &st);
+    void do_cm(operand_stack_t &st);
+    void do_q(operand_stack_t &st);
+    void do_Q(operand_stack_t &st);
+    void set_Tz(operand_stack_t &st);
+    void set_TL(operand_stack_t &st);
+    void set_Tc(operand_stack_t &st);
+    void set_Tw(operand_stack_t &st);
+    void set_Td(operand_stack_t &st);
+    void set_TD(operand_stack_t &st);
+    void set_Tm(operand_stack_t &st);
+    void set_T_star(operand_stack_t &st);
+    void set_Tf(operand_stack_t &st);
+    void set_quote(operand_stack_t &st);
+    void set_double_quote(operand_stack_t &st);
 private:
     std::pair<float, float> get_coordinates(const matrix_t &m1, const matrix_t &m2) const;
     void Td(float x, float y);
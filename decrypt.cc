@@ -3,11 +3,13 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <utility>
 
 #include <openssl/evp.h>
 #include <openssl/md5.h>
 
 #include "common.h"
+#include "decrypt.h"
 
 
 using namespace std;
@@ -19,19 +21,15 @@ namespace
 
     const unsigned char no_meta_addition[] = { 0xff, 0xff, 0xff, 0xff };
 
-    typedef enum {
-        ENCRYPT_ALGORITHM_RC4V1 = 1, ///< RC4 Version 1 encryption using a 40bit key
-        ENCRYPT_ALGORITHM_RC4V2 = 2, ///< RC4 Version 2 encryption using a key with 40-128bit
-        ENCRYPT_ALGORITHM_AESV2 = 4,  ///< AES encryption with a 128 bit key (PDF1.6)
-        ENCRYPT_ALGORITHM_IDENTITY = 8 ///No encryption
-    } encrypt_algorithm_t;
-
     typedef enum {
         PDF_KEY_LENGTH_128 = 128,
         PDF_KEY_LENGTH_256 = 256
     } pdf_key_length_t;
 
-    enum { DEFAULT_LENGTH = 40, AES_IV_LENGTH = 16 };
+    enum { DEFAULT_LENGTH = 40, AES_IV_LENGTH = 16, AES_BLOCK_SIZE = 16 };
+
+    //7.6.4.3.3. /U and /O of revisions 5 and 6: hash, validation salt and key salt
+    enum { HASH_LENGTH = 32, SALT_LENGTH = 8, VALIDATION_SALT_OFFSET = 32, KEY_SALT_OFFSET = 40, USER_DATA_LENGTH = 48 };
 
 
     array<unsigned char, 32> get_user_pad(const string& password)
@@ -54,32 +52,44 @@ namespace
         throw pdf_error(FUNC_STRING + "wrong bool value:" + it->second.first);
     }
 
+    //RC4 is available only in legacy provider of OpenSSL 3, so it is implemented here. text_in can be text_out
     int RC4(const unsigned char* key, int key_len, const unsigned char* text_in, int text_len, unsigned char* text_out)
-
     {
-        EVP_CIPHER_CTX rc4;
-        EVP_CIPHER_CTX_init(&rc4);
-        unique_ptr<EVP_CIPHER_CTX, int (*)(EVP_CIPHER_CTX*)>  rc4_scope(&rc4, EVP_CIPHER_CTX_cleanup);
-        // Don't set the key because we will modify the parameters
-        int status = EVP_EncryptInit_ex(&rc4, EVP_rc4(), NULL, NULL, NULL);
-        if(status != 1) throw pdf_error(FUNC_STRING + "RC4 EVP_DecryptInit_ex error");
+        unsigned char state[256];
+        for (int i = 0; i < 256; ++i) state[i] = static_cast<unsigned char>(i);
+        for (int i = 0, j = 0; i < 256; ++i)
+        {
+            j = (j + state[i] + key[i % key_len]) & 0xFF;
+            swap(state[i], state[j]);
+        }
+        //indexes wrap around as unsigned char
+        unsigned char i = 0, j = 0;
+        for (int k = 0; k < text_len; ++k)
+        {
+            unsigned char si = state[++i];
+            j += si;
+            unsigned char sj = state[j];
+            state[i] = sj;
+            state[j] = si;
+            text_out[k] = text_in[k] ^ state[static_cast<unsigned char>(si + sj)];
+        }
 
-        status = EVP_CIPHER_CTX_set_key_length(&rc4, key_len);
-        if(status != 1) throw pdf_error(FUNC_STRING + "RC4 EVP_CIPHER_CTX_set_key_length error");
+        return text_len;
+    }
 
-        // We finished modifying parameters so now we can set the key
-        status = EVP_EncryptInit_ex(&rc4, NULL, NULL, key, NULL);
-        if(status != 1)throw pdf_error(FUNC_STRING + "RC4 EVP_DecryptInit_ex error");
+    //contexts are created once per thread and reinitialized for every object
+    EVP_CIPHER_CTX* get_cipher_ctx()
+    {
+        thread_local unique_ptr<EVP_CIPHER_CTX, void (*)(EVP_CIPHER_CTX*)> ctx(EVP_CIPHER_CTX_new(), EVP_CIPHER_CTX_free);
+        if (!ctx) throw pdf_error(FUNC_STRING + "error creating cipher context");
+        return ctx.get();
+    }
 
-        int data_out_moved;
-        status = EVP_EncryptUpdate(&rc4, text_out, &data_out_moved, text_in, text_len);
-        if(status != 1) throw pdf_error(FUNC_STRING + "RC4 EVP_DecryptUpdate error");
-        int written = data_out_moved;
-        status = EVP_EncryptFinal_ex(&rc4, &text_out[data_out_moved], &data_out_moved);
-        if(status != 1) throw pdf_error(FUNC_STRING + "RC4 EVP_EncryptFinal_ex error" );
-        written += data_out_moved;
-
-        return written;
+    EVP_MD_CTX* get_md_ctx()
+    {
+        thread_local unique_ptr<EVP_MD_CTX, void (*)(EVP_MD_CTX*)> ctx(EVP_MD_CTX_new(), EVP_MD_CTX_free);
+        if (!ctx) throw pdf_error(FUNC_STRING + "error creating digest context");
+        return ctx.get();
     }
 
     vector<unsigned char> string2array(const string &src)
@@ -110,41 +120,55 @@ namespace
         return ext;
     }
 
-    void md5_init_exc(MD5_CTX *ctx)
+    void md5_init_exc(EVP_MD_CTX *ctx)
     {
-        if (MD5_Init(ctx) != 1) throw pdf_error(FUNC_STRING + "error initializing MD5 hashing engine" );
+        if (EVP_DigestInit_ex(ctx, EVP_md5(), NULL) != 1) throw pdf_error(FUNC_STRING + "error initializing MD5 hashing engine" );
     }
 
-    void md5_update_exc(MD5_CTX *ctx, const void *data, unsigned long len)
+    void md5_update_exc(EVP_MD_CTX *ctx, const void *data, unsigned long len)
     {
-        if (MD5_Update(ctx, data, len) != 1) throw pdf_error(FUNC_STRING + "error MD5 update" );
+        if (EVP_DigestUpdate(ctx, data, len) != 1) throw pdf_error(FUNC_STRING + "error MD5 update" );
     }
 
-    void md5_final_exc(unsigned char *md, MD5_CTX *ctx)
+    void md5_final_exc(unsigned char *md, EVP_MD_CTX *ctx)
     {
-        if (MD5_Final(md, ctx) != 1) throw pdf_error(FUNC_STRING + "error MD5 final");
+        if (EVP_DigestFinal_ex(ctx, md, NULL) != 1) throw pdf_error(FUNC_STRING + "error MD5 final");
     }
 
     void get_md5_binary(const unsigned char* data, int length, unsigned char* digest)
     {
-        MD5_CTX ctx;
-        md5_init_exc(&ctx);
-        md5_update_exc(&ctx, data, length);
-        md5_final_exc(digest, &ctx);
+        EVP_MD_CTX *ctx = get_md_ctx();
+        md5_init_exc(ctx);
+        md5_update_exc(ctx, data, length);
+        md5_final_exc(digest, ctx);
+    }
+
+    string get_digest(const EVP_MD *md, const string &data)
+    {
+        unsigned char digest[EVP_MAX_MD_SIZE];
+        unsigned int len;
+        EVP_MD_CTX *ctx = get_md_ctx();
+        if (EVP_DigestInit_ex(ctx, md, NULL) != 1 ||
+            EVP_DigestUpdate(ctx, data.data(), data.length()) != 1 ||
+            EVP_DigestFinal_ex(ctx, digest, &len) != 1)
+        {
+            throw pdf_error(FUNC_STRING + "error SHA-2 hashing");
+        }
+        return string(reinterpret_cast<char*>(digest), len);
     }
 
     vector<unsigned char> get_decryption_key(const dict_t &decrypt_opts)
     {
         unsigned int key_length = get_length(decrypt_opts);
-        MD5_CTX ctx;
-        md5_init_exc(&ctx);
+        EVP_MD_CTX *ctx = get_md_ctx();
+        md5_init_exc(ctx);
 
-        md5_update_exc(&ctx, padding, 32);
+        md5_update_exc(ctx, padding, 32);
         const string o_val = decode_string(decrypt_opts.at("/O").first);
-        md5_update_exc(&ctx, get_user_pad(o_val).data(), 32);
+        md5_update_exc(ctx, get_user_pad(o_val).data(), 32);
 
         array<unsigned char, 4> ext = get_ext(decrypt_opts);
-        md5_update_exc(&ctx, ext.data(), 4);
+        md5_update_exc(ctx, ext.data(), 4);
         //get_first_array_element
         size_t offset = skip_spaces(decrypt_opts.at("/ID").first, 1);
         string document_id = decode_string(get_string(decrypt_opts.at("/ID").first, offset));
@@ -152,18 +176,18 @@ namespace
         if (!document_id.empty())
         {
             doc_id = string2array(document_id);
-            md5_update_exc(&ctx, doc_id.data(), doc_id.size());
+            md5_update_exc(ctx, doc_id.data(), doc_id.size());
         }
 
         // If document metadata is not being encrypted,
         // pass 4 bytes with the value 0xFFFFFFFF to the MD5 hash function.
         if (!is_encrypt_metadata(decrypt_opts))
         {
-            md5_update_exc(&ctx, no_meta_addition, sizeof(no_meta_addition)/sizeof(unsigned char));
+            md5_update_exc(ctx, no_meta_addition, sizeof(no_meta_addition)/sizeof(unsigned char));
         }
 
         unsigned char digest[MD5_DIGEST_LENGTH];
-        md5_final_exc(digest, &ctx);
+        md5_final_exc(digest, ctx);
 
         unsigned int revision = strict_stoul(decrypt_opts.at("/R").first);
         // only use the really needed bits as input for the hash
@@ -178,10 +202,10 @@ namespace
         // Setup user key
         if (revision == 3 || revision == 4)
         {
-            md5_init_exc(&ctx);
-            md5_update_exc(&ctx, padding, 32);
-            if (!document_id.empty()) md5_update_exc(&ctx, doc_id.data(), document_id.length());
-            md5_final_exc(digest, &ctx);
+            md5_init_exc(ctx);
+            md5_update_exc(ctx, padding, 32);
+            if (!document_id.empty()) md5_update_exc(ctx, doc_id.data(), document_id.length());
+            md5_final_exc(digest, ctx);
             memcpy(user_key, digest, 16);
             for (int k = 16; k < 32; ++k) user_key[k] = 0;
             for (int k = 0; k < 20; k++)
@@ -198,33 +222,42 @@ namespace
         return decryption_key;
     }
 
-    encrypt_algorithm_t get_algorithm(const dict_t &decrypt_opts)
+    //7.6.5. Crypt Filters. Only standard filter /StdCF is supported
+    Decryptor::encrypt_algorithm_t get_crypt_filter_algorithm(const dict_t &decrypt_opts)
+    {
+        if (decrypt_opts.count("/CF") == 0) return Decryptor::ENCRYPT_ALGORITHM_IDENTITY;
+        const dict_t CF_dict = get_dictionary_data(decrypt_opts.at("/CF").first, 0);
+        if (CF_dict.count("/StdCF") == 0) return Decryptor::ENCRYPT_ALGORITHM_IDENTITY;
+        const dict_t stdCF_dict = get_dictionary_data(CF_dict.at("/StdCF").first, 0);
+        auto it = stdCF_dict.find("/CFM");
+        if (it == stdCF_dict.end()) return Decryptor::ENCRYPT_ALGORITHM_IDENTITY;
+        //TODO: add /None support(custom decryption algorithm)
+        if (it->second.first == "/V2") return Decryptor::ENCRYPT_ALGORITHM_RC4V2;
+        if (it->second.first == "/AESV2") return Decryptor::ENCRYPT_ALGORITHM_AESV2;
+        if (it->second.first == "/AESV3") return Decryptor::ENCRYPT_ALGORITHM_AESV3;
+        throw pdf_error(FUNC_STRING + "wrong /CFM value:" + it->second.first);
+    }
+
+    Decryptor::encrypt_algorithm_t get_algorithm(const dict_t &decrypt_opts)
     {
         const string val = decrypt_opts.at("/R").first;
         switch (strict_stoul(val))
         {
         case 2:
         {
-            return ENCRYPT_ALGORITHM_RC4V1;
+            return Decryptor::ENCRYPT_ALGORITHM_RC4V1;
             break;
         }
         case 3:
         {
-            return ENCRYPT_ALGORITHM_RC4V2;
+            return Decryptor::ENCRYPT_ALGORITHM_RC4V2;
             break;
         }
         case 4:
+        case 5:
+        case 6:
         {
-            if (decrypt_opts.count("/CF") == 0) return ENCRYPT_ALGORITHM_IDENTITY;
-            const dict_t CF_dict = get_dictionary_data(decrypt_opts.at("/CF").first, 0);
-            if (CF_dict.count("/StdCF") == 0) return ENCRYPT_ALGORITHM_IDENTITY;
-            const dict_t stdCF_dict = get_dictionary_data(CF_dict.at("/StdCF").first, 0);
-            auto it = stdCF_dict.find("/CFM");
-            if (it == stdCF_dict.end()) return ENCRYPT_ALGORITHM_IDENTITY;
-            //TODO: add /None support(custom decryption algorithm)
-            if (it->second.first == "/V2") return ENCRYPT_ALGORITHM_RC4V2;
-            if (it->second.first == "/AESV2") return ENCRYPT_ALGORITHM_AESV2;
-            throw pdf_error(FUNC_STRING + "wrong /CFM value:" + it->second.first);
+            return get_crypt_filter_algorithm(decrypt_opts);
             break;
         }
         default:
@@ -235,52 +268,17 @@ namespace
         }
     }
 
-    void create_obj_key(unsigned int n,
-                        unsigned int g,
-                        unsigned char obj_key[MD5_DIGEST_LENGTH],
-                        int *key_len,
-                        const dict_t &decrypt_opts)
+    const EVP_CIPHER* get_aes_cipher(int key_len)
     {
-        unsigned char nkey[MD5_DIGEST_LENGTH + 5 + 4];
-        const vector<unsigned char> decryption_key = get_decryption_key(decrypt_opts);
-
-        int local_key_len = decryption_key.size() + 5;
-
-        for (size_t j = 0; j < decryption_key.size(); j++) nkey[j] = decryption_key[j];
-        nkey[decryption_key.size() + 0] = static_cast<unsigned char>(0xff &  n);
-        nkey[decryption_key.size() + 1] = static_cast<unsigned char>(0xff & (n >> 8));
-        nkey[decryption_key.size() + 2] = static_cast<unsigned char>(0xff & (n >> 16));
-        nkey[decryption_key.size() + 3] = static_cast<unsigned char>(0xff &  g);
-        nkey[decryption_key.size() + 4] = static_cast<unsigned char>(0xff & (g >> 8));
-
-        if (get_algorithm(decrypt_opts) == ENCRYPT_ALGORITHM_AESV2)
+        switch (key_len)
         {
-            // AES encryption needs some 'salt'
-            local_key_len += 4;
-            nkey[decryption_key.size() + 5] = 0x73;
-            nkey[decryption_key.size() + 6] = 0x41;
-            nkey[decryption_key.size() + 7] = 0x6c;
-            nkey[decryption_key.size() + 8] = 0x54;
+        case PDF_KEY_LENGTH_128 / 8:
+            return EVP_aes_128_cbc();
+        case PDF_KEY_LENGTH_256 / 8:
+            return EVP_aes_256_cbc();
+        default:
+            throw pdf_error(FUNC_STRING + "invalid AES key length: " + to_string(key_len));
         }
-
-        get_md5_binary(nkey, local_key_len, obj_key);
-        *key_len = (decryption_key.size() <= 11) ? decryption_key.size() + 5 : 16;
-    }
-
-    string decrypt_rc4(unsigned int n, unsigned int g, const string &in_str, const dict_t &decrypt_opts)
-    {
-        vector<unsigned char> in = string2array(in_str);
-        unsigned char obj_key[MD5_DIGEST_LENGTH];
-        int key_len;
-
-        create_obj_key(n, g, obj_key, &key_len, decrypt_opts);
-        vector<unsigned char> out_str;
-        int out_len = key_len * 8 == 40? EVP_CIPHER_block_size(EVP_rc4_40()) + in.size():
-        EVP_CIPHER_block_size(EVP_rc4()) + in.size();
-        out_str.insert(out_str.end(), out_len, 0);
-        out_len = RC4(obj_key, key_len, in.data(), in.size(), out_str.data());
-
-        return string(reinterpret_cast<char*>(out_str.data()), out_len);
     }
 
     void aes_base_decrypt(const unsigned char* key,
@@ -289,72 +287,207 @@ namespace
                           const unsigned char* text_in,
                           int text_len,
                           unsigned char* text_out,
-                          int &out_len)
+                          int &out_len,
+                          bool use_padding)
     {
-        EVP_CIPHER_CTX aes;
-        EVP_CIPHER_CTX_init(&aes);
-        unique_ptr<EVP_CIPHER_CTX, int (*)(EVP_CIPHER_CTX*)>  aes_scope(&aes, EVP_CIPHER_CTX_cleanup);
-        if ((text_len % 16) != 0) throw pdf_error(FUNC_STRING + "error: AES data length must be multiple of 16" );
-        int status;
-        switch (key_len)
-        {
-        case PDF_KEY_LENGTH_128 / 8:
-            status = EVP_DecryptInit_ex(&aes, EVP_aes_128_cbc(), NULL, key, iv);
-            break;
-        case PDF_KEY_LENGTH_256 / 8:
-            status = EVP_DecryptInit_ex(&aes, EVP_aes_256_cbc(), NULL, key, iv);
-            break;
-        default:
-            throw pdf_error(FUNC_STRING + "invalid AES key length: " + to_string(key_len));
-            break;
-        }
+        if ((text_len % AES_BLOCK_SIZE) != 0) throw pdf_error(FUNC_STRING + "error: AES data length must be multiple of 16" );
+        EVP_CIPHER_CTX *aes = get_cipher_ctx();
+        int status = EVP_DecryptInit_ex(aes, get_aes_cipher(key_len), NULL, key, iv);
         if(status != 1) throw pdf_error(FUNC_STRING + "error initializing AES decryption engine" );
+        EVP_CIPHER_CTX_set_padding(aes, use_padding? 1 : 0);
 
         int data_out_moved;
-        status = EVP_DecryptUpdate(&aes, text_out, &data_out_moved, text_in, text_len);
+        status = EVP_DecryptUpdate(aes, text_out, &data_out_moved, text_in, text_len);
         out_len = data_out_moved;
         if(status != 1) throw pdf_error(FUNC_STRING + "Error AES-decryption data" );
 
-        status = EVP_DecryptFinal_ex(&aes, text_out + out_len, &data_out_moved);
+        status = EVP_DecryptFinal_ex(aes, text_out + out_len, &data_out_moved);
         out_len += data_out_moved;
         if(status != 1) throw pdf_error(FUNC_STRING + "Error AES-decryption data final");
     }
 
-    string decrypt_aesv2(unsigned int n, unsigned int g, const string &in_str, const dict_t &decrypt_opts)
+    //AES-128 in CBC mode without padding for Algorithm 2.B
+    string aes_128_encrypt(const unsigned char* key, const unsigned char* iv, const string &text)
     {
-        vector<unsigned char> in = string2array(in_str);
-        unsigned char obj_key[MD5_DIGEST_LENGTH];
-        int key_len;
-
-        create_obj_key(n, g, obj_key, &key_len, decrypt_opts);
-        int out_buffer_len = in.size() - 2 - AES_IV_LENGTH;
-        vector<unsigned char> out_buffer(out_buffer_len + 16 - (out_buffer_len % 16));
-        aes_base_decrypt(obj_key,
-                         key_len,
-                         in.data(),
-                         in.data() + AES_IV_LENGTH,
-                         in.size() - AES_IV_LENGTH,
-                         out_buffer.data(), out_buffer_len);
-        return string(reinterpret_cast<char*>(out_buffer.data()), out_buffer_len);
+        string result(text.length(), '\0');
+        EVP_CIPHER_CTX *aes = get_cipher_ctx();
+        int out_len;
+        if (EVP_EncryptInit_ex(aes, EVP_aes_128_cbc(), NULL, key, iv) != 1 ||
+            EVP_CIPHER_CTX_set_padding(aes, 0) != 1 ||
+            EVP_EncryptUpdate(aes,
+                              reinterpret_cast<unsigned char*>(&result[0]),
+                              &out_len,
+                              reinterpret_cast<const unsigned char*>(text.data()),
+                              text.length()) != 1)
+        {
+            throw pdf_error(FUNC_STRING + "Error AES-encryption data");
+        }
+        return result;
+    }
+
+    //7.6.4.3.4. Algorithm 2.B: hash of password for revision 6. Revision 5 uses only SHA-256
+    string get_password_hash(unsigned int revision, const string &password, const string &salt, const string &user_data)
+    {
+        string k = get_digest(EVP_sha256(), password + salt + user_data);
+        if (revision == 5) return k;
+        string e;
+        for (unsigned int i = 0; i < 64 || static_cast<unsigned char>(e.back()) > i - 32; ++i)
+        {
+            string k1;
+            for (int j = 0; j < 64; ++j) k1 += password + k + user_data;
+            const unsigned char *key = reinterpret_cast<const unsigned char*>(k.data());
+            e = aes_128_encrypt(key, key + AES_BLOCK_SIZE, k1);
+            unsigned int sum = 0;
+            for (int j = 0; j < AES_BLOCK_SIZE; ++j) sum += static_cast<unsigned char>(e[j]);
+            switch (sum % 3)
+            {
+            case 0:
+                k = get_digest(EVP_sha256(), e);
+                break;
+            case 1:
+                k = get_digest(EVP_sha384(), e);
+                break;
+            default:
+                k = get_digest(EVP_sha512(), e);
+                break;
+            }
+        }
+        return k.substr(0, HASH_LENGTH);
+    }
+
+    //7.6.4.3.3. Algorithm 2.A for empty password: file key is decrypted from /UE or /OE by intermediate key
+    vector<unsigned char> get_aes256_decryption_key(const dict_t &decrypt_opts)
+    {
+        unsigned int revision = strict_stoul(decrypt_opts.at("/R").first);
+        const string u_val = decode_string(decrypt_opts.at("/U").first);
+        const string o_val = decode_string(decrypt_opts.at("/O").first);
+        if (u_val.length() < USER_DATA_LENGTH || o_val.length() < USER_DATA_LENGTH)
+        {
+            throw pdf_error(FUNC_STRING + "/U and /O must have 48 bytes");
+        }
+        const string user_data = u_val.substr(0, USER_DATA_LENGTH);
+        string intermediate_key, encrypted_key;
+        if (get_password_hash(revision, string(), u_val.substr(VALIDATION_SALT_OFFSET, SALT_LENGTH), string()) ==
+            u_val.substr(0, HASH_LENGTH))
+        {
+            intermediate_key = get_password_hash(revision, string(), u_val.substr(KEY_SALT_OFFSET, SALT_LENGTH), string());
+            encrypted_key = decode_string(decrypt_opts.at("/UE").first);
+        }
+        else if (get_password_hash(revision, string(), o_val.substr(VALIDATION_SALT_OFFSET, SALT_LENGTH), user_data) ==
+                 o_val.substr(0, HASH_LENGTH))
+        {
+            intermediate_key = get_password_hash(revision, string(), o_val.substr(KEY_SALT_OFFSET, SALT_LENGTH), user_data);
+            encrypted_key = decode_string(decrypt_opts.at("/OE").first);
+        }
+        else
+        {
+            throw pdf_error(FUNC_STRING + "document is protected by password");
+        }
+        if (encrypted_key.length() < HASH_LENGTH) throw pdf_error(FUNC_STRING + "/UE and /OE must have 32 bytes");
+        vector<unsigned char> decryption_key(HASH_LENGTH);
+        const unsigned char iv[AES_IV_LENGTH] = {};
+        int out_len;
+        aes_base_decrypt(reinterpret_cast<const unsigned char*>(intermediate_key.data()),
+                         intermediate_key.length(),
+                         iv,
+                         reinterpret_cast<const unsigned char*>(encrypted_key.data()),
+                         HASH_LENGTH,
+                         decryption_key.data(),
+                         out_len,
+                         false);
+        return decryption_key;
     }
 }
 
-string decrypt(unsigned int n, unsigned int g, const string &in_str, const dict_t &decrypt_opts)
+Decryptor::Decryptor(const dict_t &decrypt_opts) : algorithm(ENCRYPT_ALGORITHM_IDENTITY)
+{
+    if (decrypt_opts.empty()) return;
+    algorithm = get_algorithm(decrypt_opts);
+    if (algorithm == ENCRYPT_ALGORITHM_AESV3) decryption_key = get_aes256_decryption_key(decrypt_opts);
+    else if (algorithm != ENCRYPT_ALGORITHM_IDENTITY) decryption_key = get_decryption_key(decrypt_opts);
+}
+
+void Decryptor::decrypt(unsigned int n, unsigned int g, string &data) const
 {
-    if (decrypt_opts.empty()) return in_str;
-    encrypt_algorithm_t algorithm = get_algorithm(decrypt_opts);
     switch (algorithm)
     {
     case ENCRYPT_ALGORITHM_RC4V1:
     case ENCRYPT_ALGORITHM_RC4V2:
-        return decrypt_rc4(n, g, in_str, decrypt_opts);
+        decrypt_rc4(n, g, data);
         break;
     case ENCRYPT_ALGORITHM_AESV2:
-        return decrypt_aesv2(n, g, in_str, decrypt_opts);
+    case ENCRYPT_ALGORITHM_AESV3:
+        decrypt_aes(n, g, data);
+        break;
     case ENCRYPT_ALGORITHM_IDENTITY:
-        return in_str;
+        break;
     default:
         throw pdf_error("Unknown algorithm: " + to_string(algorithm));
         break;
     }
 }
+
+//7.6.2. Algorithm 1: object key is MD5 of document key, object number and generation
+size_t Decryptor::create_obj_key(unsigned int n, unsigned int g, unsigned char *obj_key) const
+{
+    unsigned char nkey[MD5_DIGEST_LENGTH + 5 + 4];
+    int local_key_len = decryption_key.size() + 5;
+
+    for (size_t j = 0; j < decryption_key.size(); j++) nkey[j] = decryption_key[j];
+    nkey[decryption_key.size() + 0] = static_cast<unsigned char>(0xff &  n);
+    nkey[decryption_key.size() + 1] = static_cast<unsigned char>(0xff & (n >> 8));
+    nkey[decryption_key.size() + 2] = static_cast<unsigned char>(0xff & (n >> 16));
+    nkey[decryption_key.size() + 3] = static_cast<unsigned char>(0xff &  g);
+    nkey[decryption_key.size() + 4] = static_cast<unsigned char>(0xff & (g >> 8));
+
+    if (algorithm == ENCRYPT_ALGORITHM_AESV2)
+    {
+        // AES encryption needs some 'salt'
+        local_key_len += 4;
+        nkey[decryption_key.size() + 5] = 0x73;
+        nkey[decryption_key.size() + 6] = 0x41;
+        nkey[decryption_key.size() + 7] = 0x6c;
+        nkey[decryption_key.size() + 8] = 0x54;
+    }
+
+    get_md5_binary(nkey, local_key_len, obj_key);
+    return (decryption_key.size() <= 11) ? decryption_key.size() + 5 : 16;
+}
+
+void Decryptor::decrypt_rc4(unsigned int n, unsigned int g, string &data) const
+{
+    unsigned char obj_key[MD5_DIGEST_LENGTH];
+    int key_len = create_obj_key(n, g, obj_key);
+    unsigned char *text = reinterpret_cast<unsigned char*>(&data[0]);
+    RC4(obj_key, key_len, text, data.length(), text);
+}
+
+//7.6.3.3. AESV3 uses the file key for all objects.
+//Decrypted data is written to buffer of the thread, and the buffer takes memory of encrypted data for the next call
+void Decryptor::decrypt_aes(unsigned int n, unsigned int g, string &data) const
+{
+    thread_local string buffer;
+    unsigned char obj_key[MD5_DIGEST_LENGTH];
+    const unsigned char *key = decryption_key.data();
+    int key_len = decryption_key.size();
+    if (algorithm == ENCRYPT_ALGORITHM_AESV2)
+    {
+        key_len = create_obj_key(n, g, obj_key);
+        key = obj_key;
+    }
+    if (data.length() < AES_IV_LENGTH) throw pdf_error(FUNC_STRING + "AES data must start with initialization vector");
+    //output of decryption is never longer than input without initialization vector plus one block
+    buffer.resize(data.length());
+    const unsigned char *in = reinterpret_cast<const unsigned char*>(data.data());
+    int out_len;
+    aes_base_decrypt(key,
+                     key_len,
+                     in,
+                     in + AES_IV_LENGTH,
+                     data.length() - AES_IV_LENGTH,
+                     reinterpret_cast<unsigned char*>(&buffer[0]),
+                     out_len,
+                     true);
+    buffer.resize(out_len);
+    data.swap(buffer);
+}
@@ -0,0 +1,35 @@
+#ifndef DECRYPT_H
+#define DECRYPT_H
+
+#include <string>
+#include <vector>
+
+#include "common.h"
+
+//7.6.3. Standard Security Handler.
+//key of the document is computed once, only object keys are computed for every decrypted object
+class Decryptor
+{
+public:
+    typedef enum {
+        ENCRYPT_ALGORITHM_RC4V1 = 1, ///< RC4 Version 1 encryption using a 40bit key
+        ENCRYPT_ALGORITHM_RC4V2 = 2, ///< RC4 Version 2 encryption using a key with 40-128bit
+        ENCRYPT_ALGORITHM_AESV2 = 4,  ///< AES encryption with a 128 bit key (PDF1.6)
+        ENCRYPT_ALGORITHM_IDENTITY = 8, ///No encryption
+        ENCRYPT_ALGORITHM_AESV3 = 16 ///< AES encryption with a 256 bit key (PDF 2.0)
+    } encrypt_algorithm_t;
+
+    //empty decrypt_opts means document isn`t encrypted
+    explicit Decryptor(const dict_t &decrypt_opts);
+    //data is decrypted in place
+    void decrypt(unsigned int n, unsigned int g, std::string &data) const;
+private:
+    size_t create_obj_key(unsigned int n, unsigned int g, unsigned char *obj_key) const;
+    void decrypt_rc4(unsigned int n, unsigned int g, std::string &data) const;
+    void decrypt_aes(unsigned int n, unsigned int g, std::string &data) const;
+private:
+    encrypt_algorithm_t algorithm;
+    std::vector<unsigned char> decryption_key;
+};
+
+#endif //DECRYPT_H
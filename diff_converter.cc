@@ -2,6 +2,7 @@
 #include <string>
 #include <utility>
 #include <algorithm>
+#include <memory>
 
 #include <boost/optional.hpp>
 
@@ -41,7 +42,8 @@ DiffConverter DiffConverter::get_converter(const dict_t &dictionary,
     auto it = dictionary.find("/BaseEncoding");
     PDFEncode_t encoding = (it == dictionary.end())? DEFAULT : get_encoding(it->second.first);
 
-    const array_t array_data = get_array_or_indirect_array(differences, storage);
+    const shared_ptr<const array_t> array_ptr = get_array_or_indirect_array(differences, storage);
+    const array_t &array_data = *array_ptr;
 
     unordered_map<unsigned int, string> code2symbol = standard_encodings.at(encoding);
 
@@ -1,2261 +0,0 @@
-{nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, &PagesExtractor::do_double_quote, nullptr, 
-nullptr, nullptr, nullptr, &PagesExtractor::do_quote, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-&PagesExtractor::do_Q, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, &PagesExtractor::do_q, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-&PagesExtractor::do_BI, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, &PagesExtractor::do_BT, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, &PagesExtractor::do_Do, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-&PagesExtractor::do_ET, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, &PagesExtractor::do_T_star, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, &PagesExtractor::do_TD, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-&PagesExtractor::do_TJ, nullptr, &PagesExtractor::do_TL, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-&PagesExtractor::do_Tc, &PagesExtractor::do_Td, nullptr, &PagesExtractor::do_Tf, nullptr, 
-nullptr, nullptr, &PagesExtractor::do_Tj, nullptr, nullptr, 
-&PagesExtractor::do_Tm, nullptr, nullptr, nullptr, nullptr, 
-nullptr, &PagesExtractor::do_Ts, nullptr, nullptr, nullptr, 
-&PagesExtractor::do_Tw, nullptr, nullptr, &PagesExtractor::do_Tz, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-nullptr, nullptr, nullptr, nullptr, nullptr, 
-&PagesExtractor::do_cm}
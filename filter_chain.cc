@@ -0,0 +1,164 @@
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <utility>
+
+#include "filter_chain.h"
+#include "pdf_extractor.h"
+
+using namespace std;
+
+extern unique_ptr<FilterStage> make_flate_stage(unique_ptr<FilterStage> &&source, const dict_t &opts);
+extern unique_ptr<FilterStage> make_ascii85_stage(unique_ptr<FilterStage> &&source, const dict_t &opts);
+extern unique_ptr<FilterStage> make_ascii_hex_stage(unique_ptr<FilterStage> &&source, const dict_t &opts);
+extern unique_ptr<FilterStage> make_lzw_stage(unique_ptr<FilterStage> &&source, const dict_t &opts);
+extern unique_ptr<FilterStage> make_run_length_stage(unique_ptr<FilterStage> &&source, const dict_t &opts);
+extern string flate_decode(const string&, const dict_t&);
+extern string lzw_decode(const string&, const dict_t&);
+extern string ascii85_decode(const string&, const dict_t&);
+extern string ascii_hex_decode(const string&, const dict_t&);
+extern string run_length_decode(const string&, const dict_t&);
+
+namespace
+{
+    class SourceStage : public FilterStage
+    {
+    public:
+        explicit SourceStage(boost::string_view content_arg) : content(content_arg)
+        {
+        }
+
+        boost::string_view read() override
+        {
+            boost::string_view result = content;
+            content.clear();
+            return result;
+        }
+    private:
+        boost::string_view content;
+    };
+
+    class WholeStreamStage : public FilterStage
+    {
+    public:
+        WholeStreamStage(unique_ptr<FilterStage> &&source_arg, const filter_decode_t &decode_arg, const dict_t &opts_arg) :
+                         source(std::move(source_arg)), decode(decode_arg), opts(opts_arg), is_decoded(false)
+        {
+        }
+
+        boost::string_view read() override
+        {
+            if (is_decoded) return boost::string_view();
+            is_decoded = true;
+            string content;
+            for (boost::string_view chunk = source->read(); !chunk.empty(); chunk = source->read())
+            {
+                content.append(chunk.data(), chunk.length());
+            }
+            result = decode(content, opts);
+            return result;
+        }
+    private:
+        unique_ptr<FilterStage> source;
+        const filter_decode_t decode;
+        const dict_t opts;
+        string result;
+        bool is_decoded;
+    };
+
+    string pass_through_decode(const string &content, const dict_t &opts)
+    {
+        return content;
+    }
+
+    unique_ptr<FilterStage> make_pass_through_stage(unique_ptr<FilterStage> &&source, const dict_t &opts)
+    {
+        return std::move(source);
+    }
+
+    map<string, filter_t> make_filters()
+    {
+        const filter_t flate = {flate_decode, make_flate_stage};
+        const filter_t lzw = {lzw_decode, make_lzw_stage};
+        const filter_t ascii85 = {ascii85_decode, make_ascii85_stage};
+        const filter_t ascii_hex = {ascii_hex_decode, make_ascii_hex_stage};
+        const filter_t run_length = {run_length_decode, make_run_length_stage};
+        const filter_t pass_through = {pass_through_decode, make_pass_through_stage};
+        //7.4.10. data of streams is decrypted before filters are applied
+        return map<string, filter_t>{{"/FlateDecode", flate}, {"/Fl", flate},
+                                     {"/LZWDecode", lzw}, {"/LZW", lzw},
+                                     {"/ASCII85Decode", ascii85}, {"/A85", ascii85},
+                                     {"/ASCIIHexDecode", ascii_hex}, {"/AHx", ascii_hex},
+                                     {"/RunLengthDecode", run_length}, {"/RL", run_length},
+                                     {"/CCITTFaxDecode", pass_through}, {"/CCF", pass_through},
+                                     {"/DCTDecode", pass_through}, {"/DCT", pass_through},
+                                     {"/JBIG2Decode", pass_through},
+                                     {"/JPXDecode", pass_through},
+                                     {"/Crypt", pass_through}};
+    }
+
+    map<string, filter_t>& get_filters_registry()
+    {
+        static map<string, filter_t> filters = make_filters();
+        return filters;
+    }
+}
+
+void register_filter(const string &name, const filter_t &filter)
+{
+    get_filters_registry()[name] = filter;
+}
+
+void register_stream_filter(const string &name, const stream_filter_t &filter)
+{
+    if (!filter) throw pdf_error(FUNC_STRING + "filter " + name + " is empty");
+    auto decode = [filter](const string &content, const dict_t &opts)
+    {
+        map<string, string> params;
+        for (const dict_t::value_type &p : opts) params.emplace(p.first, p.second.first);
+        return filter(content, params);
+    };
+    register_filter(name, filter_t{decode, nullptr});
+}
+
+const filter_t& get_filter(const string &name)
+{
+    const map<string, filter_t> &filters = get_filters_registry();
+    auto it = filters.find(name);
+    if (it == filters.end()) throw pdf_error(FUNC_STRING + "unknown filter " + name);
+    return it->second;
+}
+
+FilterChain::FilterChain(boost::string_view content, const vector<string> &filters, const vector<dict_t> &decode_params) :
+                         last_stage(new SourceStage(content))
+{
+    if (filters.size() != decode_params.size())
+    {
+        throw pdf_error(FUNC_STRING + "different sizes for filters and decode_params");
+    }
+    for (size_t i = 0; i < filters.size(); ++i)
+    {
+        const filter_t &filter = get_filter(filters[i]);
+        if (filter.make_stage)
+        {
+            last_stage = filter.make_stage(std::move(last_stage), decode_params[i]);
+        }
+        else
+        {
+            last_stage.reset(new WholeStreamStage(std::move(last_stage), filter.decode, decode_params[i]));
+        }
+    }
+}
+
+boost::string_view FilterChain::read()
+{
+    return last_stage->read();
+}
+
+string FilterChain::read_all()
+{
+    string result;
+    for (boost::string_view chunk = read(); !chunk.empty(); chunk = read()) result.append(chunk.data(), chunk.length());
+    return result;
+}
@@ -0,0 +1,56 @@
+#ifndef FILTER_CHAIN_H
+#define FILTER_CHAIN_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+
+#include <boost/utility/string_view.hpp>
+
+#include "common.h"
+
+enum { FILTER_CHUNK_SIZE = 65536 };
+
+//7.4 Filters. Stage pulls encoded data from the previous stage by chunks,
+//so intermediate results of chained filters are never materialized in full
+class FilterStage
+{
+public:
+    virtual ~FilterStage() = default;
+    //returns next decoded chunk, it is valid until the next call. Empty chunk means end of data
+    virtual boost::string_view read() = 0;
+};
+
+//decodes the whole content of the stream
+using filter_decode_t = std::function<std::string(const std::string &content, const dict_t &opts)>;
+//makes stage which decodes output of source
+typedef std::unique_ptr<FilterStage> (*filter_make_stage_t)(std::unique_ptr<FilterStage> &&source, const dict_t &opts);
+
+//filter without make_stage decodes all data of the previous stage at once
+struct filter_t
+{
+    filter_decode_t decode;
+    filter_make_stage_t make_stage;
+};
+
+//filters are looked up by name. Standard filters are registered together with their abbreviations (8.9.7).
+//Image only filters leave data encoded, because text isn`t extracted from it.
+//Registry isn`t synchronized, so filters must be registered before documents are parsed.
+//Library users register filters with register_stream_filter from pdf_extractor.h
+void register_filter(const std::string &name, const filter_t &filter);
+//throws pdf_error for unknown filter
+const filter_t& get_filter(const std::string &name);
+
+class FilterChain
+{
+public:
+    //content must outlive the chain
+    FilterChain(boost::string_view content, const std::vector<std::string> &filters, const std::vector<dict_t> &decode_params);
+    boost::string_view read();
+    std::string read_all();
+private:
+    std::unique_ptr<FilterStage> last_stage;
+};
+
+#endif //FILTER_CHAIN_H
@@ -1,55 +1,155 @@
 #include <zlib.h>
 
 #include <string>
+#include <memory>
+#include <limits>
+#include <cstring>
+#include <algorithm>
 
 #include "common.h"
+#include "filter_chain.h"
+#include "predictor.h"
 
 
 using namespace std;
 
-enum {BLOCK_SIZE = 4096};
+enum
+{
+    MIN_OUTPUT_SIZE = 4096,
+    //typical ratio for content streams, output grows twice when it is not enough
+    COMPRESSION_RATIO = 4,
+    //deflate can`t compress better
+    MAX_COMPRESSION_RATIO = 1032
+};
 
 namespace
 {
-    string decompress_block(z_stream *strm, const string &data)
+    //7.3.8.2. /DL is length of decoded stream. It is only a hint, so broken or huge values are ignored
+    size_t get_output_size(const string &data, const dict_t &opts)
     {
-        Bytef buffer[BLOCK_SIZE];
-        char *src = const_cast<char*>(data.data());
-        size_t src_len = data.length();
-        string result;
-
-        strm->avail_in = src_len;
-        strm->next_in = reinterpret_cast<Bytef*>(src);
-        do
+        auto it = opts.find("/DL");
+        if (it != opts.end() && it->second.second == VALUE)
         {
-            strm->avail_out = BLOCK_SIZE;
-            strm->next_out  = buffer;
-            int ret = inflate(strm, Z_NO_FLUSH);
-            if (ret == Z_STREAM_ERROR ||
-                ret == Z_NEED_DICT ||
-                ret == Z_MEM_ERROR ||
-                ret == Z_DATA_ERROR ||
-                ret == Z_BUF_ERROR) throw pdf_error(FUNC_STRING + "inflate error");
-
-            if (strm->avail_out < 0) throw pdf_error(FUNC_STRING + "decompressing error: avail_out <=0");
-            result.append(reinterpret_cast<const char*>(buffer), BLOCK_SIZE - strm->avail_out);
+            try
+            {
+                size_t len = strict_stoul(it->second.first);
+                //one more byte lets inflate see end of stream without growing output
+                if (len / MAX_COMPRESSION_RATIO <= data.length()) return len + 1;
+            }
+            catch (const pdf_error&)
+            {
+            }
         }
-        while (strm->avail_out == 0);
+        return max<size_t>(MIN_OUTPUT_SIZE, data.length() * COMPRESSION_RATIO);
+    }
 
-        return result;
+    void check_inflate_result(int ret)
+    {
+        if (ret == Z_STREAM_ERROR ||
+            ret == Z_NEED_DICT ||
+            ret == Z_MEM_ERROR ||
+            ret == Z_DATA_ERROR ||
+            ret == Z_BUF_ERROR) throw pdf_error(FUNC_STRING + "inflate error");
     }
+
+    class FlateStage : public FilterStage
+    {
+    public:
+        explicit FlateStage(unique_ptr<FilterStage> &&source_arg) :
+                            source(std::move(source_arg)), strm(), finished(false), output(FILTER_CHUNK_SIZE, '\0')
+        {
+            if (inflateInit(&strm) != Z_OK) throw pdf_error(FUNC_STRING + "inflateInit is not Z_OK");
+        }
+
+        ~FlateStage()
+        {
+            inflateEnd(&strm);
+        }
+
+        boost::string_view read() override
+        {
+            strm.next_out = reinterpret_cast<Bytef*>(&output[0]);
+            strm.avail_out = output.length();
+            while (!finished && strm.avail_out)
+            {
+                if (strm.avail_in == 0)
+                {
+                    if (input.empty()) input = source->read();
+                    uInt len = min<size_t>(input.length(), numeric_limits<uInt>::max());
+                    strm.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+                    strm.avail_in = len;
+                    input.remove_prefix(len);
+                }
+                //without input inflate still flushes output which didn`t fit before
+                int ret = inflate(&strm, Z_NO_FLUSH);
+                //truncated stream, decoded data is returned as is
+                if (ret == Z_BUF_ERROR && strm.avail_in == 0)
+                {
+                    finished = true;
+                    break;
+                }
+                check_inflate_result(ret);
+                if (ret == Z_STREAM_END) finished = true;
+            }
+            return boost::string_view(output.data(), output.length() - strm.avail_out);
+        }
+    private:
+        unique_ptr<FilterStage> source;
+        //part of the source chunk which is not passed to inflate yet
+        boost::string_view input;
+        z_stream strm;
+        bool finished;
+        string output;
+    };
 }
 
+//inflates straight into result. Predictor decodes complete rows in place right after they are inflated,
+//so data is passed once and result contains only decoded rows and tail of the incomplete one
 string flate_decode(const string &data, const dict_t &opts)
 {
+    Predictor predictor(opts);
     z_stream strm  = {0};
     strm.zalloc = Z_NULL;
     strm.zfree  = Z_NULL;
     strm.opaque = Z_NULL;
 
     if (inflateInit(&strm) != Z_OK) throw pdf_error(FUNC_STRING + "inflateInit2 is not Z_OK");
-    string result = decompress_block(&strm, data);
-    inflateEnd(&strm);
-    if (opts.empty()) return result;
-    return predictor_decode(result, opts);
+    unique_ptr<z_stream, int(*)(z_stream*)> strm_guard(&strm, inflateEnd);
+    strm.avail_in = data.length();
+    strm.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+
+    string result(get_output_size(data, opts), '\0');
+    //result: [decoded rows][inflated but not decoded data][free space]
+    size_t decoded_end = 0;
+    size_t inflated_end = 0;
+    bool output_is_full;
+    int ret;
+    do
+    {
+        if (inflated_end == result.length()) result.resize(result.length() * 2);
+        uInt avail_out = min<size_t>(result.length() - inflated_end, numeric_limits<uInt>::max());
+        strm.avail_out = avail_out;
+        strm.next_out = reinterpret_cast<Bytef*>(&result[inflated_end]);
+        ret = inflate(&strm, Z_NO_FLUSH);
+        //truncated stream without end marker: input is over, inflated data is kept
+        if (ret == Z_BUF_ERROR && strm.avail_in == 0) break;
+        check_inflate_result(ret);
+        output_is_full = (strm.avail_out == 0);
+        inflated_end += avail_out - strm.avail_out;
+
+        size_t offset = predictor.decode_rows(&result[0], decoded_end, inflated_end, decoded_end);
+        size_t tail_len = inflated_end - offset;
+        if (offset != decoded_end) memmove(&result[decoded_end], &result[offset], tail_len);
+        inflated_end = decoded_end + tail_len;
+    }
+    while (ret != Z_STREAM_END && output_is_full);
+    //incomplete last row is dropped
+    result.resize(decoded_end);
+
+    return result;
+}
+
+unique_ptr<FilterStage> make_flate_stage(unique_ptr<FilterStage> &&source, const dict_t &opts)
+{
+    return make_predictor_stage(unique_ptr<FilterStage>(new FlateStage(std::move(source))), opts);
 }
@@ -23,12 +23,11 @@ void get_binary(string &source)
     for (char &c : source) c -= '0';
 }
 
-cmap_t get_FontFile(const string &doc,
+cmap_t get_FontFile(boost::string_view doc,
                     const ObjectStorage &storage,
-                    const pair<unsigned int, unsigned int> &cmap_id_gen,
-                    const dict_t &decrypt_data)
+                    const pair<unsigned int, unsigned int> &cmap_id_gen)
 {
-        const string stream = get_stream(doc, cmap_id_gen, storage, decrypt_data);
+        const string stream = get_stream(doc, cmap_id_gen, storage);
         cmap_t cmap;
         cmap.is_vertical = false;
         vector<string> st;
@@ -8,10 +8,9 @@
 #include "common.h"
 
 
-cmap_t get_FontFile(const std::string &doc,
+cmap_t get_FontFile(boost::string_view doc,
                     const ObjectStorage &storage,
-                    const std::pair<unsigned int, unsigned int> &cmap_id_gen,
-                    const dict_t &decrypt_data);
+                    const std::pair<unsigned int, unsigned int> &cmap_id_gen);
 
 
 #endif //FONT_FILE_H
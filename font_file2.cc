@@ -18,13 +18,12 @@ void get_format4_data(cmap_t &cmap, const string &stream, size_t off);
 void get_format6_data(cmap_t &cmap, const string &stream, size_t off);
 void get_format12_data(cmap_t &cmap, const string &stream, size_t off);
 
-cmap_t get_FontFile2(const string &doc,
+cmap_t get_FontFile2(boost::string_view doc,
                      const ObjectStorage &storage,
-                     const pair<unsigned int, unsigned int> &cmap_id_gen,
-                     const dict_t &decrypt_data)
+                     const pair<unsigned int, unsigned int> &cmap_id_gen)
 {
     enum { TAG_SIZE = 4 };
-    const string stream = get_stream(doc, cmap_id_gen, storage, decrypt_data);
+    const string stream = get_stream(doc, cmap_id_gen, storage);
     uint16_t tables_num = get_integer<uint16_t>(stream, sizeof(uint32_t));
     uint16_t i = 0;
     for (i = 0; i < tables_num; ++i)
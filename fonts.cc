@@ -4,6 +4,7 @@
 #include <map>
 #include <algorithm>
 #include <vector>
+#include <memory>
 
 #include "fonts.h"
 #include "object_storage.h"
@@ -20,13 +21,17 @@ Fonts::Fonts(const ObjectStorage &storage, const dict_t &fonts_dict): rise(RISE_
 {
         for (const dict_t::value_type &p : fonts_dict)
         {
-            dict_t font_dict = get_dict_or_indirect_dict(p.second, storage);
+            //font dictionary is extended by descendant font, so it is copied
+            dict_t font_dict = *get_dict_or_indirect_dict(p.second, storage);
             Font_type_t type = insert_type(p.first, font_dict);
             if (type == TYPE_3) insert_matrix_type3(p.first, font_dict);
             insert_descendant(font_dict, storage);
             dictionary_per_font.emplace(p.first, font_dict);
             auto it = font_dict.find("/FontDescriptor");
-            const dict_t desc_dict = (it == font_dict.end())? dict_t() : get_dict_or_indirect_dict(it->second, storage);
+            const shared_ptr<const dict_t> desc_ptr = (it == font_dict.end())?
+                                                      make_shared<const dict_t>() :
+                                                      get_dict_or_indirect_dict(it->second, storage);
+            const dict_t &desc_dict = *desc_ptr;
 
             it = font_dict.find("/BaseFont");
             string base_font;
@@ -42,14 +47,14 @@ void Fonts::insert_descendant(dict_t &font, const ObjectStorage &storage)
 {
     const string type = font.at("/Subtype").first;
     if (type != "/Type0") return;
-    const array_t array = get_array_or_indirect_array(font.at("/DescendantFonts"), storage);
-    if (array.size() != DESCENDANT_ARRAY_NUM)
+    const shared_ptr<const array_t> array = get_array_or_indirect_array(font.at("/DescendantFonts"), storage);
+    if (array->size() != DESCENDANT_ARRAY_NUM)
     {
         throw pdf_error(FUNC_STRING + "DescendantFonts array must have" +
-                        to_string(DESCENDANT_ARRAY_NUM) + " element. Size=" + to_string(array.size()));
+                        to_string(DESCENDANT_ARRAY_NUM) + " element. Size=" + to_string(array->size()));
     }
-    const dict_t descendant = get_dict_or_indirect_dict(array[0], storage);
-    font.insert(descendant.begin(), descendant.end());
+    const shared_ptr<const dict_t> descendant = get_dict_or_indirect_dict((*array)[0], storage);
+    font.insert(descendant->begin(), descendant->end());
 }
 
 float Fonts::get_width(unsigned int code) const
@@ -79,7 +84,8 @@ void Fonts::insert_widths_from_w(const ObjectStorage &storage, const string &fon
                                           widths.emplace(font_name, Widths());
         return;
     }
-    array_t result = get_array_or_indirect_array(it->second, storage);
+    //indirect values are resolved in place, so array is copied
+    array_t result = *get_array_or_indirect_array(it->second, storage);
     for (array_t::value_type &p : result)
     {
         if (p.second == INDIRECT_OBJECT) p = get_indirect_object_data(p.first, storage);
@@ -105,10 +111,10 @@ void Fonts::insert_widths_from_w(const ObjectStorage &storage, const string &fon
         case ARRAY:
         {
             unsigned int start_char = strict_stoul(result[i].first);
-            const array_t w_array = get_array_data(result[i + 1].first, 0);
-            for (const array_t::value_type &p : w_array)
+            const array_view_t w_array = get_array_data_view(result[i + 1].first, 0);
+            for (const array_view_t::value_type &p : w_array)
             {
-                font_width->emplace_back(start_char, stof(p.first));
+                font_width->emplace_back(start_char, stof(p.first.to_string()));
                 ++start_char;
             }
             i += 2;
@@ -137,7 +143,8 @@ void Fonts::insert_widths_from_widths(const ObjectStorage &storage,
                                           widths.emplace(font_name, Widths());
         return;
     }
-    const array_t result = get_array_or_indirect_array(it->second, storage);
+    const shared_ptr<const array_t> result_ptr = get_array_or_indirect_array(it->second, storage);
+    const array_t &result = *result_ptr;
     widths.emplace(font_name, Widths());
     vector<pair<unsigned int, float>> *font_width = *widths[font_name];
     font_width->reserve(result.size());
@@ -169,15 +176,15 @@ void Fonts::insert_matrix_type3(const string &font_name, const dict_t &font)
     const pair<string, pdf_object_t> p = font.at("/FontMatrix");
     if (p.second != ARRAY) throw pdf_error(FUNC_STRING + "/FontMatrix must be ARRAY. Type=" + to_string(p.second) +
                                            " value=" + p.first);
-    const array_t data = get_array_data(p.first, 0);
+    const array_view_t data = get_array_data_view(p.first, 0);
     matrix_t matrix;
     if (data.size() != matrix.size()) throw pdf_error(FUNC_STRING + "/FontMatrix must have " +
                                                       to_string(matrix.size()) + " elements");
     for (size_t i = 0; i < matrix.size(); ++i)
     {
         if (data[i].second != VALUE) throw pdf_error(FUNC_STRING + "/FontMatrix element must be VALUE.Type=" +
-                                                     to_string(data[i].second) + " value=" + data[i].first);
-        matrix[i] = stof(data[i].first);
+                                                     to_string(data[i].second) + " value=" + data[i].first.to_string());
+        matrix[i] = stof(data[i].first.to_string());
     }
     font_matrix_type_3.emplace(font_name, std::move(matrix));
 }
@@ -221,8 +228,8 @@ void Fonts::insert_height(const string &font_name,
         heights.emplace(font_name, it->second.height);
         return;
     }
-    const array_t array = get_array_or_indirect_array(it->second, storage);
-    heights.emplace(font_name, stof(array.at(3).first) - stof(array.at(1).first));
+    const shared_ptr<const array_t> array = get_array_or_indirect_array(it->second, storage);
+    heights.emplace(font_name, stof(array->at(3).first) - stof(array->at(1).first));
 }
 
 void Fonts::insert_descent(const string &font_name,
@@ -243,8 +250,8 @@ void Fonts::insert_descent(const string &font_name,
         auto it = font.find("/FontBBox");
         if (it != font.end())
         {
-            const array_t array = get_array_or_indirect_array(it->second, storage);
-            descents.emplace(font_name, stof(array.at(1).first));
+            const shared_ptr<const array_t> array = get_array_or_indirect_array(it->second, storage);
+            descents.emplace(font_name, stof(array->at(1).first));
             return;
         }
     }
@@ -277,8 +284,8 @@ void Fonts::insert_ascent(const string &font_name,
         auto it = font.find("/FontBBox");
         if (it != font.end())
         {
-            const array_t array = get_array_or_indirect_array(it->second, storage);
-            ascents.emplace(font_name, stof(array.at(3).first));
+            const shared_ptr<const array_t> array = get_array_or_indirect_array(it->second, storage);
+            ascents.emplace(font_name, stof(array->at(3).first));
             return;
         }
     }
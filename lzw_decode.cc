@@ -1,130 +1,211 @@
 #include <string>
 #include <vector>
+#include <memory>
+#include <utility>
+#include <algorithm>
 #include <cstdint>
 
 #include "common.h"
+#include "filter_chain.h"
+#include "predictor.h"
 
 using namespace std;
+
+//7.4.4. LZWDecode and FlateDecode Filters
 namespace
 {
-    struct lzw_item_t
+    enum
     {
-        vector<unsigned char> value;
+        LZW_TABLE_SIZE = 4096,
+        LZW_CLEAR = 256,
+        LZW_EOD = 257,
+        LZW_FIRST_CODE = 258,
+        LZW_MIN_CODE_LEN = 9,
+        LZW_MAX_CODE_LEN = 12,
+        NO_CODE = LZW_TABLE_SIZE
     };
 
-    typedef vector<lzw_item_t> lzw_table_t;
-    enum { LZW_TABLE_SIZE = 4096 };
-    const unsigned short masks[4] = { 0x01FF, 0x03FF, 0x07FF, 0x0FFF };
-    const unsigned short clear = 0x0100;
-    const unsigned short eod = 0x0101;
-
-    lzw_table_t init_table()
+    //string of the code is its prefix string followed by suffix, so every entry costs 6 bytes
+    struct lzw_entry_t
     {
-        lzw_table_t table;
-        table.reserve(LZW_TABLE_SIZE);
-        for(int i = 0; i <= 255; i++)
-        {
-            lzw_item_t item;
-            item.value.push_back(static_cast<unsigned char>(i));
-            table.push_back(item);
-        }
-        // Add dummy entry, which is never used by decoder
-        lzw_item_t item;
-        table.push_back(item);
+        uint16_t prefix;
+        uint16_t length;
+        unsigned char suffix;
+        unsigned char first;
+    };
 
-        return table;
+    unsigned int get_early_change(const dict_t &opts)
+    {
+        auto it = opts.find("/EarlyChange");
+        if (it == opts.end()) return 1;
+        return strict_stoul(it->second.first)? 1 : 0;
     }
-}
 
-string lzw_decode(const string& buf, const dict_t &opts)
-{
-    unsigned int  mask = 0;
-    unsigned int  code_len = 9;
-    unsigned char character = 0;
-
-    lzw_table_t table = init_table();
-    unsigned int       buffer_size = 0;
-    const unsigned int buffer_max  = 24;
-
-    uint32_t         old         = 0;
-    uint32_t         code        = 0;
-    uint32_t         buffer      = 0;
-
-    lzw_item_t           item;
-
-    vector<unsigned char> data;
-    string result;
-    size_t len = buf.length();
-    const char *pBuffer = buf.data();
-    character = *pBuffer;
-
-    while (len)
+    class LZWDecoder
     {
-        // Fill the buffer
-        while (buffer_size <= (buffer_max - 8) && len)
+    public:
+        explicit LZWDecoder(unsigned int early_change_arg) : table(LZW_TABLE_SIZE),
+                                                              early_change(early_change_arg),
+                                                              bits(0),
+                                                              bits_len(0),
+                                                              finished(false)
+        {
+            for (unsigned int i = 0; i < LZW_CLEAR; ++i)
+            {
+                table[i].prefix = NO_CODE;
+                table[i].length = 1;
+                table[i].suffix = table[i].first = static_cast<unsigned char>(i);
+            }
+            clear();
+        }
+
+        //appends decoded data to result, data after EOD is ignored
+        void decode(boost::string_view data, string &result)
         {
-            buffer <<= 8;
-            buffer |= static_cast<uint32_t>(static_cast<unsigned char>(*pBuffer));
-            buffer_size += 8;
+            //result is grown in advance and cut to decoded data at the end
+            size_t end = result.length();
+            for (size_t i = 0; i < data.length() && !finished; ++i)
+            {
+                bits = (bits << 8) | static_cast<unsigned char>(data[i]);
+                bits_len += 8;
+                while (bits_len >= code_len)
+                {
+                    bits_len -= code_len;
+                    unsigned int code = (bits >> bits_len) & ((1u << code_len) - 1);
+                    if (!decode_code(code, result, end))
+                    {
+                        finished = true;
+                        break;
+                    }
+                }
+            }
+            result.resize(end);
+        }
 
-            ++pBuffer;
-            len--;
+        bool is_finished() const
+        {
+            return finished;
         }
-        // read from the buffer
-        while (buffer_size >= code_len)
+    private:
+        void clear()
         {
-            code         = (buffer >> (buffer_size - code_len)) & masks[mask];
-            buffer_size -= code_len;
+            next_code = LZW_FIRST_CODE;
+            code_len = LZW_MIN_CODE_LEN;
+            old = NO_CODE;
+        }
 
-            if (code == clear)
+        //returns false on EOD
+        bool decode_code(unsigned int code, string &result, size_t &end)
+        {
+            if (code == LZW_CLEAR)
             {
-                mask     = 0;
-                code_len = 9;
-
-                table = init_table();
+                clear();
+                return true;
+            }
+            if (code == LZW_EOD) return false;
+            if (old == NO_CODE)
+            {
+                if (code >= LZW_CLEAR) throw pdf_error(FUNC_STRING + "value out of range");
+                append(code, result, end);
+                old = code;
+                return true;
             }
-            else if (code == eod)
+            unsigned char first;
+            if (code < next_code)
             {
-                len = 0;
-                break;
+                append(code, result, end);
+                first = table[code].first;
+            }
+            else if (code == next_code)
+            {
+                //code is not in the table yet: string of old code followed by its first byte
+                append(old, result, end);
+                first = table[old].first;
+                result[end++] = static_cast<char>(first);
             }
             else
             {
-                if (code >= table.size())
-                {
-                    if (old >= table.size())
-                    {
-                        throw pdf_error(FUNC_STRING + "value out of range");
-                    }
-                    data = table[old].value;
-                    data.push_back(character);
-                }
-                else
-                    data = table[code].value;
-                result.append(reinterpret_cast<char*>(data.data()), data.size());
-                character = data[0];
-                if( old < table.size() ) // fix the first loop
-                    data = table[old].value;
-                data.push_back(character);
+                throw pdf_error(FUNC_STRING + "value out of range");
+            }
+            if (next_code < LZW_TABLE_SIZE)
+            {
+                lzw_entry_t &entry = table[next_code++];
+                entry.prefix = old;
+                entry.length = table[old].length + 1;
+                entry.suffix = first;
+                entry.first = table[old].first;
+            }
+            if (next_code + early_change >= (1u << code_len) && code_len < LZW_MAX_CODE_LEN) ++code_len;
+            old = code;
+            return true;
+        }
 
-                item.value = data;
-                table.push_back(item);
+        //string is written from its end by prefix back-pointers. Space for one more byte is left for the code
+        //which is not in the table yet
+        void append(unsigned int code, string &result, size_t &end)
+        {
+            size_t len = table[code].length;
+            if (end + len + 1 > result.length()) result.resize(max(result.length() * 2, end + LZW_TABLE_SIZE));
+            end += len;
+            char *p = &result[end];
+            for (size_t i = 0; i < len; ++i)
+            {
+                *--p = static_cast<char>(table[code].suffix);
+                code = table[code].prefix;
+            }
+        }
+    private:
+        vector<lzw_entry_t> table;
+        const unsigned int early_change;
+        unsigned int next_code;
+        unsigned int code_len;
+        unsigned int old;
+        uint32_t bits;
+        unsigned int bits_len;
+        bool finished;
+    };
 
-                old = code;
+    class LZWStage : public FilterStage
+    {
+    public:
+        LZWStage(unique_ptr<FilterStage> &&source_arg, unsigned int early_change) : source(std::move(source_arg)),
+                                                                                     decoder(early_change)
+        {
+        }
 
-                switch(table.size())
-                {
-                case 511:
-                case 1023:
-                case 2047:
-                    ++code_len;
-                    ++mask;
-                default:
-                    break;
-                }
+        boost::string_view read() override
+        {
+            output.clear();
+            while (output.empty() && !decoder.is_finished())
+            {
+                if (input.empty()) input = source->read();
+                if (input.empty()) break;
+                size_t len = min<size_t>(input.length(), FILTER_CHUNK_SIZE);
+                decoder.decode(input.substr(0, len), output);
+                input.remove_prefix(len);
             }
+            return output;
         }
-    }
+    private:
+        unique_ptr<FilterStage> source;
+        boost::string_view input;
+        LZWDecoder decoder;
+        string output;
+    };
+}
+
+string lzw_decode(const string& buf, const dict_t &opts)
+{
+    LZWDecoder decoder(get_early_change(opts));
+    string result;
+    result.reserve(buf.length() * 3);
+    decoder.decode(buf, result);
     if (opts.empty()) return result;
-    return predictor_decode(result, opts);
+    return predictor_decode(std::move(result), opts);
+}
+
+unique_ptr<FilterStage> make_lzw_stage(unique_ptr<FilterStage> &&source, const dict_t &opts)
+{
+    unique_ptr<FilterStage> stage(new LZWStage(std::move(source), get_early_change(opts)));
+    return make_predictor_stage(std::move(stage), opts);
 }
@@ -0,0 +1,57 @@
+#include <string>
+#include <cstring>
+#include <cerrno>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "mapped_file.h"
+#include "common.h"
+
+using namespace std;
+
+MappedFile::MappedFile(const string &path) : data(MAP_FAILED), size(0)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) throw pdf_error(FUNC_STRING + "can`t open " + path + ": " + strerror(errno));
+    try
+    {
+        map(fd);
+    }
+    catch (...)
+    {
+        close(fd);
+        throw;
+    }
+    //mapping stays valid after descriptor is closed
+    close(fd);
+}
+
+MappedFile::MappedFile(int fd) : data(MAP_FAILED), size(0)
+{
+    map(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data != MAP_FAILED) munmap(data, size);
+}
+
+boost::string_view MappedFile::get_data() const
+{
+    return boost::string_view(static_cast<const char*>(data), size);
+}
+
+void MappedFile::map(int fd)
+{
+    struct stat st;
+    if (fstat(fd, &st) == -1) throw pdf_error(FUNC_STRING + "fstat failed: " + strerror(errno));
+    if (st.st_size == 0) throw pdf_error(FUNC_STRING + "file is empty");
+    size = st.st_size;
+    data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) throw pdf_error(FUNC_STRING + "mmap failed: " + strerror(errno));
+    //objects are accessed by offsets from cross-reference data, so readahead of whole file is useless
+    madvise(data, size, MADV_RANDOM);
+}
@@ -0,0 +1,25 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+
+#include <boost/utility/string_view.hpp>
+
+//read-only mapping of the whole file, pages are loaded by OS on first access
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string &path);
+    explicit MappedFile(int fd);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+    boost::string_view get_data() const;
+private:
+    void map(int fd);
+private:
+    void *data;
+    size_t size;
+};
+
+#endif //MAPPED_FILE_H
@@ -1,7 +1,8 @@
 #include <string>
-#include <map>
+#include <algorithm>
 #include <utility>
 #include <vector>
+#include <memory>
 
 #include "object_storage.h"
 #include "common.h"
@@ -9,66 +10,219 @@
 
 using namespace std;
 
-extern string decrypt(unsigned int n,
-                      unsigned int g,
-                      const string &in,
-                      const dict_t &decrypt_opts);
+namespace
+{
+    bool has_compressed_entries(const xref_t &xref)
+    {
+        for (const xref_entry_t &entry : xref)
+        {
+            if (entry.type == xref_entry_t::COMPRESSED) return true;
+        }
+        return false;
+    }
+}
 
-ObjectStorage::ObjectStorage(const string &doc_arg, map<size_t, size_t> &&id2offsets_arg, const dict_t &decrypt_data) :
-                             doc(doc_arg), id2offsets(move(id2offsets_arg))
+ObjectStorage::ObjectStorage(boost::string_view doc_arg,
+                             xref_t &&xref_arg,
+                             const dict_t &decrypt_data_arg,
+                             size_t cache_capacity_arg /*= DEFAULT_CACHE_CAPACITY*/) :
+                             doc(doc_arg),
+                             decryptor(decrypt_data_arg),
+                             xref(move(xref_arg)),
+                             xref_has_compressed(has_compressed_entries(xref)),
+                             all_obj_stms_checked(false),
+                             cache_capacity(max<size_t>(cache_capacity_arg, 1)),
+                             cache_hits(0),
+                             cache_misses(0),
+                             skipped_bytes(0)
 {
-    for (const pair<size_t, size_t> &p : id2offsets) insert_obj_stream(p.first, decrypt_data);
 }
 
 pair<string, pdf_object_t> ObjectStorage::get_object(size_t id) const
 {
-    auto it = id2offsets.find(id);
+    xref_entry_t::type_t type = (id < xref.size())? xref[id].type : xref_entry_t::FREE;
+    if (type == xref_entry_t::IN_USE) return ::get_object(doc, id, xref);
     //object is located inside object stream
-    if (it == id2offsets.end()) return id2obj_stm.at(id);
-    return ::get_object(doc, id, id2offsets);
+    lock_guard<mutex> lock(obj_stm_mutex);
+    pair<string, pdf_object_t> result;
+    if (find_obj_stm_object(id, result)) return result;
+    if (type == xref_entry_t::COMPRESSED)
+    {
+        size_t obj_stm_id = xref[id].value;
+        if (obj_stm_id < xref.size() && xref[obj_stm_id].type == xref_entry_t::IN_USE)
+        {
+            insert_obj_stream(obj_stm_id);
+            if (find_obj_stm_object(id, result)) return result;
+        }
+    }
+    //cross-reference data doesn`t point to object streams(e.g. xref table is used), so all of them are searched.
+    //Otherwise free and missing objects are dangling references, which are common
+    if (!xref_has_compressed)
+    {
+        insert_all_obj_streams();
+        if (find_obj_stm_object(id, result)) return result;
+    }
+    throw pdf_error(FUNC_STRING + "object " + to_string(id) + " is not found");
 }
 
-const map<size_t, size_t>& ObjectStorage::get_id2offsets() const
+bool ObjectStorage::find_obj_stm_object(size_t id, pair<string, pdf_object_t> &result) const
 {
-    return id2offsets;
+    if (id >= obj_stm_objects.size() || !obj_stm_objects[id].second) return false;
+    result = obj_stm_objects[id];
+    return true;
 }
 
-size_t ObjectStorage::get_gen_id(size_t offset) const
+shared_ptr<const dict_t> ObjectStorage::get_dict(size_t id) const
 {
-    offset = efind_first(doc, " \r\t\n", offset);
-    offset = efind_number(doc, offset);
-    size_t end_offset = efind_first(doc, " \r\t\n", offset);
-    return strict_stoul(doc.substr(offset, end_offset - offset));
+    return get_cached_object(id, DICTIONARY).dict;
 }
 
-void ObjectStorage::insert_obj_stream(size_t id, const dict_t &decrypt_data)
+shared_ptr<const array_t> ObjectStorage::get_array(size_t id) const
 {
-    size_t offset = id2offsets.at(id);
-    offset = skip_comments(doc, offset);
-    size_t gen_id = get_gen_id(offset);
+    return get_cached_object(id, ARRAY).array;
+}
+
+size_t ObjectStorage::get_offset(size_t id) const
+{
+    return get_object_offset(id, xref);
+}
+
+const Decryptor& ObjectStorage::get_decryptor() const
+{
+    return decryptor;
+}
+
+size_t ObjectStorage::get_cache_hits() const
+{
+    lock_guard<mutex> lock(cache_mutex);
+    return cache_hits;
+}
+
+size_t ObjectStorage::get_cache_misses() const
+{
+    lock_guard<mutex> lock(cache_mutex);
+    return cache_misses;
+}
+
+void ObjectStorage::skip_stream(size_t id, const dict_t &props) const
+{
+    {
+        lock_guard<mutex> lock(skipped_mutex);
+        if (!skipped_streams.insert(id).second) return;
+    }
+    size_t len = 0;
+    //wrong length of skipped stream doesn`t prevent extraction of text
+    try
+    {
+        len = get_length(doc, *this, props);
+    }
+    catch (const pdf_error&)
+    {
+        return;
+    }
+    lock_guard<mutex> lock(skipped_mutex);
+    skipped_bytes += len;
+}
+
+size_t ObjectStorage::get_skipped_bytes() const
+{
+    lock_guard<mutex> lock(skipped_mutex);
+    return skipped_bytes;
+}
+
+ObjectStorage::cached_object_t ObjectStorage::get_cached_object(size_t id, pdf_object_t type) const
+{
+    cached_object_t result;
+    {
+        lock_guard<mutex> lock(cache_mutex);
+        auto it = id2cached.find(id);
+        if (it != id2cached.end())
+        {
+            ++cache_hits;
+            cache.splice(cache.begin(), cache, it->second);
+            result = *it->second;
+        }
+        else
+        {
+            ++cache_misses;
+        }
+    }
+    if (!result.type)
+    {
+        //object is parsed without lock, so several threads can parse the same object simultaneously
+        const pair<string, pdf_object_t> object = get_object(id);
+        result = cached_object_t{id, object.second, nullptr, nullptr};
+        if (object.second == DICTIONARY) result.dict = make_shared<const dict_t>(get_dictionary_data(object.first, 0));
+        if (object.second == ARRAY) result.array = make_shared<const array_t>(get_array_data(object.first, 0));
+        lock_guard<mutex> lock(cache_mutex);
+        if (!id2cached.count(id))
+        {
+            cache.push_front(result);
+            id2cached.emplace(id, cache.begin());
+            if (cache.size() > cache_capacity)
+            {
+                id2cached.erase(cache.back().id);
+                cache.pop_back();
+            }
+        }
+    }
+    if (result.type != type)
+    {
+        throw pdf_error(FUNC_STRING + "object " + to_string(id) + " has wrong type=" + to_string(result.type));
+    }
+    return result;
+}
+
+void ObjectStorage::insert_all_obj_streams() const
+{
+    if (all_obj_stms_checked) return;
+    for (size_t id = 0; id < xref.size(); ++id)
+    {
+        if (xref[id].type == xref_entry_t::IN_USE) insert_obj_stream(id);
+    }
+    all_obj_stms_checked = true;
+}
+
+void ObjectStorage::insert_obj_stream(size_t id) const
+{
+    if (!checked_obj_stms.insert(id).second) return;
+    size_t offset = xref[id].value;
     offset = skip_comments(doc, offset);
     offset = efind(doc, "obj", offset);
     offset += LEN("obj");
     if (get_object_type(doc, offset) != DICTIONARY) return;
-    dict_t dictionary = get_dictionary_data(get_dictionary(doc, offset), 0);
-    auto it = dictionary.find("/Type");
-    if (it == dictionary.end() || it->second.first != "/ObjStm") return;
-    unsigned int len = get_length<map<size_t, size_t>>(doc, id2offsets, dictionary);
+    //most of objects aren`t object streams, so their dictionaries aren`t copied
+    const boost::string_view dictionary_view = get_dictionary_view(doc, offset);
+    const dict_view_t type_data = get_dictionary_data_view(dictionary_view, 0);
+    auto it = type_data.find("/Type");
+    if (it == type_data.end() || it->second.first != "/ObjStm") return;
+    const dict_t dictionary = get_dictionary_data(dictionary_view, 0);
+    unsigned int len = get_length(doc, xref, dictionary);
     string content = get_content(doc, len, offset);
-    content = decrypt(id, gen_id, content, decrypt_data);
-    content = decode(content, dictionary);
+    decryptor.decrypt(id, xref[id].gen, content);
+    content = decode(std::move(content), dictionary);
 
     vector<pair<size_t, size_t>> id2offsets_obj_stm = get_id2offsets_obj_stm(content, dictionary);
     offset = strict_stoul(dictionary.at("/First").first);
     for (const pair<size_t, size_t> &p : id2offsets_obj_stm)
     {
+        //skip old versions of objects which were moved to another object stream by incremental update
+        if (p.first < xref.size() && xref[p.first].type != xref_entry_t::FREE &&
+            (xref[p.first].type != xref_entry_t::COMPRESSED || xref[p.first].value != id)) continue;
+        //ids which are absent in cross-reference data are limited by number of objects in the stream
+        if (p.first >= xref.size() + id2offsets_obj_stm.size()) continue;
+        if (p.first >= obj_stm_objects.size()) obj_stm_objects.resize(max(p.first + 1, xref.size()));
+        pair<string, pdf_object_t> &obj = obj_stm_objects[p.first];
+        if (obj.second) continue;
         size_t obj_offset = offset + p.second;
         pdf_object_t type = get_object_type(content, obj_offset);
-        id2obj_stm.emplace(p.first, make_pair(TYPE2FUNC.at(type)(content, obj_offset), type));
+        obj.first = TYPE2FUNC.at(type)(content, obj_offset);
+        obj.second = type;
     }
 }
 
-vector<pair<size_t, size_t>> ObjectStorage::get_id2offsets_obj_stm(const string &content, const dict_t &dictionary)
+vector<pair<size_t, size_t>> ObjectStorage::get_id2offsets_obj_stm(const string &content,
+                                                                    const dict_t &dictionary) const
 {
     vector<pair<size_t, size_t>> result;
     size_t offset = 0;
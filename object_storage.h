@@ -2,27 +2,87 @@
 #define OBJECT_STORAGE_H
 
 #include <string>
-#include <map>
 #include <utility>
 #include <vector>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <mutex>
 
 #include "common.h"
+#include "decrypt.h"
 
 class ObjectStorage
 {
 public:
-    ObjectStorage(const std::string &doc_arg, std::map<size_t, size_t> &&id2offsets_arg, const dict_t &encrypt_data);
+    enum { DEFAULT_CACHE_CAPACITY = 1024 };
+
+    ObjectStorage(boost::string_view doc_arg,
+                  xref_t &&xref_arg,
+                  const dict_t &decrypt_data_arg,
+                  size_t cache_capacity_arg = DEFAULT_CACHE_CAPACITY);
     std::pair<std::string, pdf_object_t> get_object(size_t id) const;
-    const std::map<size_t, size_t>& get_id2offsets() const;
+    std::shared_ptr<const dict_t> get_dict(size_t id) const;
+    std::shared_ptr<const array_t> get_array(size_t id) const;
+    size_t get_offset(size_t id) const;
+    const Decryptor& get_decryptor() const;
+    size_t get_cache_hits() const;
+    size_t get_cache_misses() const;
+    //stream isn`t decoded because it can`t contain text. Every stream is counted once
+    void skip_stream(size_t id, const dict_t &props) const;
+    size_t get_skipped_bytes() const;
 private:
-    size_t get_gen_id(size_t offset) const;
-    void insert_obj_stream(size_t id, const dict_t &encrypt_data);
-    std::vector<std::pair<size_t, size_t>> get_id2offsets_obj_stm(const std::string &content, const dict_t &dictionary);
+    struct cached_object_t
+    {
+        cached_object_t() : id(0), type(static_cast<pdf_object_t>(0))
+        {
+        }
+
+        cached_object_t(size_t id_arg,
+                        pdf_object_t type_arg,
+                        std::shared_ptr<const dict_t> dict_arg,
+                        std::shared_ptr<const array_t> array_arg) :
+                        id(id_arg), type(type_arg), dict(std::move(dict_arg)), array(std::move(array_arg))
+        {
+        }
+
+        size_t id;
+        pdf_object_t type;
+        std::shared_ptr<const dict_t> dict;
+        std::shared_ptr<const array_t> array;
+    };
+
+    cached_object_t get_cached_object(size_t id, pdf_object_t type) const;
+    bool find_obj_stm_object(size_t id, std::pair<std::string, pdf_object_t> &result) const;
+    void insert_obj_stream(size_t id) const;
+    void insert_all_obj_streams() const;
+    std::vector<std::pair<size_t, size_t>> get_id2offsets_obj_stm(const std::string &content,
+                                                                  const dict_t &dictionary) const;
 private:
-    const std::string &doc;
-    std::map<size_t, size_t> id2offsets;
+    const boost::string_view doc;
+    const Decryptor decryptor;
+    const xref_t xref;
+    //cross-reference streams list every compressed object, so other objects aren`t searched in object streams
+    const bool xref_has_compressed;
+    //storage is shared between extraction threads, lazily filled data is guarded by mutexes
+    mutable std::mutex obj_stm_mutex;
+    mutable std::mutex cache_mutex;
     //7.5.7. Object Streams
-    std::map<size_t, std::pair<std::string, pdf_object_t>> id2obj_stm;
+    //object streams are decoded on demand, when one of their objects is requested first time.
+    //objects are indexed by object number, zero type means object wasn`t loaded yet
+    mutable std::vector<std::pair<std::string, pdf_object_t>> obj_stm_objects;
+    mutable std::unordered_set<size_t> checked_obj_stms;
+    mutable bool all_obj_stms_checked;
+    //parsed dictionaries and arrays, the most recently used objects are at the front
+    const size_t cache_capacity;
+    mutable std::list<cached_object_t> cache;
+    mutable std::unordered_map<size_t, std::list<cached_object_t>::iterator> id2cached;
+    mutable size_t cache_hits;
+    mutable size_t cache_misses;
+    mutable std::mutex skipped_mutex;
+    mutable std::unordered_set<size_t> skipped_streams;
+    mutable size_t skipped_bytes;
 };
 
 #endif //OBJECT_STORAGE_H
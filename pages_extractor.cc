@@ -1,6 +1,8 @@
 #include <utility>
+#include <array>
 #include <unordered_set>
 #include <vector>
+#include <memory>
 #include <algorithm>
 #include <unordered_map>
 #include <boost/optional.hpp>
@@ -18,6 +20,7 @@
 #include "font_file2.h"
 #include "font_file.h"
 #include "converter_engine.h"
+#include "content_lexer.h"
 
 using namespace std;
 using namespace boost;
@@ -38,7 +41,8 @@ namespace
         unsigned char c;
     };
 
-    enum { MATRIX_ELEMENTS_NUM = 6, PDF_STRINGS_NUM = 5000 /*for optimization*/, MAX_BOXES = 300 };
+    enum { MATRIX_ELEMENTS_NUM = 6, PDF_STRINGS_NUM = 5000 /*for optimization*/, MAX_BOXES = 300,
+           MAX_FORM_DEPTH = 32 /*forms can draw themselves*/, MAX_FORM_RESULTS_SIZE = 64 * 1024 * 1024 };
     constexpr float LINE_OVERLAP = 0.5;
     constexpr float CHAR_MARGIN = 2.0;
     constexpr float WORD_MARGIN = 0.21;
@@ -51,23 +55,106 @@ namespace
         return obj1.d < obj2.d;
     }
 
+    //cached form text is in form space, CTMs without rotation and skew map its boxes to boxes
+    bool is_scale_translate(const matrix_t &m)
+    {
+        return m[1] == 0 && m[2] == 0 && m[0] != 0 && m[3] != 0;
+    }
+
+    coordinates_t transform_coordinates(const coordinates_t &c, const matrix_t &m)
+    {
+        const float x0 = c.x0 * m[0] + m[4];
+        const float x1 = c.x1 * m[0] + m[4];
+        const float y0 = c.y0 * m[3] + m[5];
+        const float y1 = c.y1 * m[3] + m[5];
+        return coordinates_t(min(x0, x1), min(y0, y1), max(x0, x1), max(y0, y1));
+    }
+
+    vector<text_chunk_t> transform_chunks(const vector<text_chunk_t> &chunks, const matrix_t &m)
+    {
+        vector<text_chunk_t> result = chunks;
+        for (text_chunk_t &chunk : result)
+        {
+            chunk.coordinates = transform_coordinates(chunk.coordinates, m);
+            for (text_t &text : chunk.texts) text.coordinates = transform_coordinates(text.coordinates, m);
+        }
+        return result;
+    }
+
+    //form stays drawn till the end of its extraction, exceptions included
+    class FormGuard
+    {
+    public:
+        FormGuard(unordered_set<unsigned int> &drawn_forms_arg,
+                  unsigned int &form_depth_arg,
+                  unsigned int form_id_arg) :
+                  drawn_forms(drawn_forms_arg), form_depth(form_depth_arg), form_id(form_id_arg)
+        {
+            drawn_forms.insert(form_id);
+            ++form_depth;
+        }
+
+        ~FormGuard()
+        {
+            drawn_forms.erase(form_id);
+            --form_depth;
+        }
+
+        FormGuard(const FormGuard&) = delete;
+        FormGuard& operator=(const FormGuard&) = delete;
+    private:
+        unordered_set<unsigned int> &drawn_forms;
+        unsigned int &form_depth;
+        const unsigned int form_id;
+    };
+
+    size_t get_chunks_size(const vector<vector<text_chunk_t>> &chunks)
+    {
+        size_t result = 0;
+        for (const vector<text_chunk_t> &v : chunks)
+        {
+            for (const text_chunk_t &chunk : v)
+            {
+                result += sizeof(text_chunk_t);
+                for (const text_t &text : chunk.texts) result += sizeof(text_t) + text.text.capacity();
+            }
+        }
+        return result;
+    }
+
     using extract_handler_t = void (PagesExtractor::*)(PagesExtractor::extract_argument_t& argument, size_t &i);
     using chunk_iterator_t = vector<text_chunk_t>::iterator;
-    extract_handler_t get_extract_handler(const string &token)
+    array<extract_handler_t, CONTENT_OPERATORS_NUM> make_extract_handlers()
     {
-        //generated by gen_extract_handlers.pl
-        static const extract_handler_t handlers[] =
-            #include "extract_handlers.h"
-            ;
-        int hash;
-        if (token.length() == 1) hash = token[0];
-        else if (token.length() == 2) hash = token[0] * 'q' + token[1];
-        else return nullptr;
-
-        if (hash < '"' || hash > 'c' * 'q' + 'm') return nullptr;
-        return handlers[hash];
+        array<extract_handler_t, CONTENT_OPERATORS_NUM> result;
+        result.fill(nullptr);
+        result[OP_BI] = &PagesExtractor::do_BI;
+        result[OP_BT] = &PagesExtractor::do_BT;
+        result[OP_Do] = &PagesExtractor::do_Do;
+        result[OP_ET] = &PagesExtractor::do_ET;
+        result[OP_Q] = &PagesExtractor::do_Q;
+        result[OP_TD] = &PagesExtractor::do_TD;
+        result[OP_TJ] = &PagesExtractor::do_TJ;
+        result[OP_TL] = &PagesExtractor::do_TL;
+        result[OP_T_star] = &PagesExtractor::do_T_star;
+        result[OP_Tc] = &PagesExtractor::do_Tc;
+        result[OP_Td] = &PagesExtractor::do_Td;
+        result[OP_Tf] = &PagesExtractor::do_Tf;
+        result[OP_Tj] = &PagesExtractor::do_Tj;
+        result[OP_Tm] = &PagesExtractor::do_Tm;
+        result[OP_Ts] = &PagesExtractor::do_Ts;
+        result[OP_Tw] = &PagesExtractor::do_Tw;
+        result[OP_Tz] = &PagesExtractor::do_Tz;
+        result[OP_cm] = &PagesExtractor::do_cm;
+        result[OP_double_quote] = &PagesExtractor::do_double_quote;
+        result[OP_q] = &PagesExtractor::do_q;
+        result[OP_quote] = &PagesExtractor::do_quote;
+        return result;
     }
 
+    //indexed by operator
+    const array<extract_handler_t, CONTENT_OPERATORS_NUM> EXTRACT_HANDLERS = make_extract_handlers();
+
     float height(const coordinates_t &obj)
     {
         return obj.y1 - obj.y0;
@@ -399,47 +486,50 @@ namespace
         }
         return result;
     }
+}
 
-    text_chunk_t make_plane(vector<text_chunk_t> &&boxes)
+text_chunk_t make_plane(vector<text_chunk_t> &&boxes)
+{
+    if (boxes.empty()) return text_chunk_t();
+    //prevent huge processing
+    if (boxes.size() > MAX_BOXES) return boxes_as_is(boxes);
+    vector<dist_t> dists;
+    dists.reserve(boxes.size() * (boxes.size() - 1));
+    for (size_t i = 0; i < boxes.size(); ++i)
     {
-        if (boxes.empty()) return text_chunk_t();
-        //prevent huge processing
-        if (boxes.size() > MAX_BOXES) return boxes_as_is(boxes);
-        vector<dist_t> dists;
-        dists.reserve(boxes.size() * (boxes.size() - 1));
-        for (size_t i = 0; i < boxes.size(); ++i)
+        for (size_t j = i + 1; j < boxes.size(); ++j) dists.emplace_back(0, get_dist(boxes[i], boxes[j]), i, j);
+    }
+    while (!dists.empty())
+    {
+        auto it = min_element(dists.begin(), dists.end());
+        if (it->c == 0 && is_between(boxes, it->obj1, it->obj2))
         {
-            for (size_t j = i + 1; j < boxes.size(); ++j) dists.emplace_back(0, get_dist(boxes[i], boxes[j]), i, j);
+            it->c = 1;
+            continue;
         }
-        while (!dists.empty())
+        const dist_t dist = *it;
+        dists.erase(remove_if(dists.begin(), dists.end(), [&dist] (const dist_t &o) {
+                    if (o.obj1 == dist.obj1 || o.obj1 == dist.obj2 ||
+                        o.obj2 == dist.obj1 || o.obj2 == dist.obj2) return true;
+                    return false;
+                    }), dists.end());
+        size_t group = create_group(boxes, dist.obj1, dist.obj2);
+        for (size_t i = 0; i < boxes.size(); ++i)
         {
-            auto it = min_element(dists.begin(), dists.end());
-            if (it->c == 0 && is_between(boxes, it->obj1, it->obj2))
-            {
-                it->c = 1;
-                continue;
-            }
-            const dist_t dist = *it;
-            dists.erase(remove_if(dists.begin(), dists.end(), [&dist] (const dist_t &o) {
-                        if (o.obj1 == dist.obj1 || o.obj1 == dist.obj2 ||
-                            o.obj2 == dist.obj1 || o.obj2 == dist.obj2) return true;
-                        return false;
-                        }), dists.end());
-            size_t group = create_group(boxes, dist.obj1, dist.obj2);
-            for (size_t i = 0; i < boxes.size(); ++i)
-            {
-                if (i == group || boxes[i].is_empty) continue;
-                dists.emplace_back(0, get_dist(boxes[group], boxes[i]), group, i);
-            }
+            if (i == group || boxes[i].is_empty) continue;
+            dists.emplace_back(0, get_dist(boxes[group], boxes[i]), group, i);
         }
+    }
 
-        for (text_chunk_t &group : boxes)
-        {
-            if (!group.is_empty) return std::move(group);
-        }
-        throw pdf_error(FUNC_STRING + "all objects are moved");
+    for (text_chunk_t &group : boxes)
+    {
+        if (!group.is_empty) return std::move(group);
     }
+    throw pdf_error(FUNC_STRING + "all objects are moved");
+}
 
+namespace
+{
     string make_string(const text_chunk_t &group)
     {
         if (group.is_empty) return string();
@@ -455,10 +545,9 @@ namespace
     }
 
     string output_content(unordered_set<unsigned int> &visited_contents,
-                          const string &buffer,
+                          boost::string_view buffer,
                           const ObjectStorage &storage,
-                          const pair<unsigned int, unsigned int> &id_gen,
-                          const dict_t &decrypt_data)
+                          const pair<unsigned int, unsigned int> &id_gen)
     {
         const pair<string, pdf_object_t> content_pair = storage.get_object(id_gen.first);
         if (content_pair.second == ARRAY)
@@ -470,11 +559,11 @@ namespace
                 //avoid infinite recursion
                 if (visited_contents.count(p.first)) continue;
                 visited_contents.insert(p.first);
-                result += output_content(visited_contents, buffer, storage, p, decrypt_data);
+                result += output_content(visited_contents, buffer, storage, p);
             }
             return result;
         }
-        return get_stream(buffer, id_gen, storage, decrypt_data);
+        return get_stream(buffer, id_gen, storage);
     }
 
     vector<pair<unsigned int, unsigned int>> get_contents_id_gen(const pair<string, pdf_object_t> &page_pair)
@@ -500,25 +589,6 @@ namespace
         }
     }
 
-    bool put2stack(vector<pair<pdf_object_t, string>> &st, const string &buffer, size_t &i)
-    {
-        switch (buffer[i])
-        {
-        case '(':
-            st.emplace_back(STRING, get_string(buffer, i));
-            return true;
-        case '<':
-            buffer.at(i + 1) == '<'? st.emplace_back(DICTIONARY, get_dictionary(buffer, i)) :
-                                     st.emplace_back(STRING, get_string(buffer, i));
-            return true;
-        case '[':
-            st.emplace_back(ARRAY, get_array(buffer, i));
-            return true;
-        default:
-            return false;
-        }
-    }
-
     unsigned int get_rotate(const dict_t &dictionary, unsigned int parent_rotate)
     {
         auto it = dictionary.find("/Rotate");
@@ -531,6 +601,14 @@ namespace
         return parent_rotate;
     }
 
+    optional<pair<string, pdf_object_t>> get_resources(const dict_t &dictionary,
+                                                       const optional<pair<string, pdf_object_t>> &parent_resources)
+    {
+        auto it = dictionary.find("/Resources");
+        if (it != dictionary.end()) return it->second;
+        return parent_resources;
+    }
+
     CharsetConverter get_charset_converter(const optional<pair<string, pdf_object_t>> &encoding)
     {
         if (!encoding) return CharsetConverter(string());
@@ -545,9 +623,9 @@ namespace
 
 PagesExtractor::PagesExtractor(unsigned int catalog_pages_id,
                                const ObjectStorage &storage_arg,
-                               const dict_t &decrypt_data_arg,
-                               const string &doc_arg) :
-                               doc(doc_arg), storage(storage_arg), decrypt_data(decrypt_data_arg)
+                               boost::string_view doc_arg) :
+                               doc(doc_arg), storage(storage_arg), form_results_size(make_shared<atomic<size_t>>(0)),
+                               form_depth(0), form_cuts(0)
 {
     const pair<string, pdf_object_t> catalog_pair = storage.get_object(catalog_pages_id);
     if (catalog_pair.second != DICTIONARY) throw pdf_error(FUNC_STRING + "catalog must be DICTIONARY");
@@ -560,14 +638,14 @@ PagesExtractor::PagesExtractor(unsigned int catalog_pages_id,
     unordered_set<unsigned int> checked_nodes;
     get_pages_resources_int(checked_nodes,
                             data,
-                            get_fonts(data, Fonts(storage, dict_t())),
+                            get_resources(data, boost::none),
                             get_box(data, boost::none),
                             get_rotate(data, 0));
 }
 
 void PagesExtractor::get_pages_resources_int(unordered_set<unsigned int> &checked_nodes,
                                              const dict_t &parent_dict,
-                                             const Fonts &parent_fonts,
+                                             const optional<pair<string, pdf_object_t>> &parent_resources,
                                              const optional<mediabox_t> &parent_media_box,
                                              unsigned int parent_rotate)
 {
@@ -589,7 +667,8 @@ void PagesExtractor::get_pages_resources_int(unordered_set<unsigned int> &checke
         {
             pages.push_back(id);
             const string id_str = to_string(id);
-            fonts.emplace(id_str, get_fonts(dict_data, parent_fonts));
+            //7.7.3.4. Inheritance of Page Attributes
+            if (parent_resources && !dict_data.count("/Resources")) dict_data.emplace("/Resources", *parent_resources);
             media_boxes.emplace(id_str, get_box(dict_data, parent_media_box).value());
             rotates.emplace(id_str, get_rotate(dict_data, parent_rotate));
             converter_engine_cache.emplace(id_str, unordered_map<string, ConverterEngine>());
@@ -600,7 +679,7 @@ void PagesExtractor::get_pages_resources_int(unordered_set<unsigned int> &checke
         {
             get_pages_resources_int(checked_nodes,
                                     dict_data,
-                                    get_fonts(dict_data, parent_fonts),
+                                    get_resources(dict_data, parent_resources),
                                     get_box(dict_data, parent_media_box),
                                     get_rotate(dict_data, parent_rotate));
 
@@ -618,20 +697,29 @@ bool PagesExtractor::get_XObject_data(const string &parent_id,
     {
         auto resources_it = parent_dict.find("/Resources");
         if (resources_it == parent_dict.end()) return false;
-        const dict_t resources = get_dict_or_indirect_dict(resources_it->second, storage);
-        auto it = resources.find("/XObject");
-        if (it == resources.end()) return false;
-        XObjects = get_dict_or_indirect_dict(it->second, storage);
+        const std::shared_ptr<const dict_t> resources = get_dict_or_indirect_dict(resources_it->second, storage);
+        auto it = resources->find("/XObject");
+        if (it == resources->end()) return false;
+        XObjects = *get_dict_or_indirect_dict(it->second, storage);
     }
 
+    //repeated Do of the same form on the page
+    if (dicts.count(resource_name)) return true;
     auto XObject = XObjects.find(XObject_name);
     if (XObject == XObjects.end()) return false;
-    dict_t dict = get_dict_or_indirect_dict(XObject->second, storage);
-    if (dict.at("/Subtype").first != "/Form") return false;
+    //form dictionary gets inherited /Resources, so it is copied
+    dict_t dict = *get_dict_or_indirect_dict(XObject->second, storage);
+    if (!is_text_stream(dict))
+    {
+        if (XObject->second.second == INDIRECT_OBJECT) storage.skip_stream(get_id_gen(XObject->second.first).first, dict);
+        return false;
+    }
+    auto subtype = dict.find("/Subtype");
+    if (subtype == dict.end() || subtype->second.first != "/Form") return false;
     if (!dict.count("/BBox")) return false;
-    fonts.emplace(resource_name, get_fonts(dict, fonts.at(parent_id)));
     converter_engine_cache.emplace(resource_name, unordered_map<string, ConverterEngine>());
-    XObject_streams.emplace(resource_name, get_stream(doc, get_id_gen(XObject->second.first), storage, decrypt_data));
+    //stream and fonts are read on extraction, cached forms don`t need them
+    XObject_id_gens.emplace(resource_name, get_id_gen(XObject->second.first));
     auto it = dict.find("Matrix");
     if (it == dict.end())
     {
@@ -639,20 +727,22 @@ bool PagesExtractor::get_XObject_data(const string &parent_id,
     }
     else
     {
-        const array_t numbers = get_array_data(it->second.first, 0);
+        const array_view_t numbers = get_array_data_view(it->second.first, 0);
         if (numbers.size() != MATRIX_ELEMENTS_NUM) throw pdf_error(FUNC_STRING + "matrix must have " +
                                                                    to_string(MATRIX_ELEMENTS_NUM) +
                                                                    "elements. Data = " + it->second.first);
-        XObject_matrices.emplace(resource_name, matrix_t{stof(numbers[0].first), stof(numbers[1].first),
-                                                         stof(numbers[2].first), stof(numbers[3].first),
-                                                         stof(numbers[4].first), stof(numbers[5].first)});
+        matrix_t matrix;
+        for (size_t i = 0; i < matrix.size(); ++i) matrix[i] = stof(numbers[i].first.to_string());
+        XObject_matrices.emplace(resource_name, matrix);
     }
     if (dict.count("/Resources"))
     {
         XObjects_cache.emplace(resource_name, dict_t());
+        cached_XObjects.insert(resource_name);
     }
     else
     {
+        fonts.emplace(resource_name, get_fonts(dict, fonts.at(parent_id)));
         dict.emplace("/Resources", parent_dict.at("/Resources"));
         XObjects_cache.emplace(resource_name, XObjects_cache.at(parent_id));
     }
@@ -660,14 +750,26 @@ bool PagesExtractor::get_XObject_data(const string &parent_id,
     return true;
 }
 
+Fonts PagesExtractor::get_page_fonts(const dict_t &page_dict)
+{
+    auto it = page_dict.find("/Resources");
+    if (it == page_dict.end()) return Fonts(storage, dict_t());
+    auto fonts_it = resources_fonts.find(it->second.first);
+    if (fonts_it == resources_fonts.end())
+    {
+        fonts_it = resources_fonts.emplace(it->second.first, get_fonts(page_dict, Fonts(storage, dict_t()))).first;
+    }
+    return fonts_it->second;
+}
+
 Fonts PagesExtractor::get_fonts(const dict_t &dictionary, const Fonts &parent_fonts) const
 {
     auto it = dictionary.find("/Resources");
     if (it == dictionary.end()) return parent_fonts;
-    const dict_t resources = get_dict_or_indirect_dict(it->second, storage);
-    it = resources.find("/Font");
-    if (it == resources.end()) return Fonts(storage, dict_t());
-    return Fonts(storage, get_dict_or_indirect_dict(it->second, storage));
+    const std::shared_ptr<const dict_t> resources = get_dict_or_indirect_dict(it->second, storage);
+    it = resources->find("/Font");
+    if (it == resources->end()) return Fonts(storage, dict_t());
+    return Fonts(storage, *get_dict_or_indirect_dict(it->second, storage));
 }
 
 mediabox_t PagesExtractor::parse_rectangle(const pair<string, pdf_object_t> &rectangle) const
@@ -678,13 +780,13 @@ mediabox_t PagesExtractor::parse_rectangle(const pair<string, pdf_object_t> &rec
     }
     const string array = (rectangle.second == INDIRECT_OBJECT)? storage.get_object(get_id_gen(rectangle.first).first).first :
                                                                 rectangle.first;
-    const array_t array_data = get_array_data(array, 0);
+    const array_view_t array_data = get_array_data_view(array, 0);
     if (array_data.size() != RECTANGLE_ELEMENTS_NUM)
     {
         throw pdf_error(FUNC_STRING + "wrong size of array. Size:" + to_string(array_data.size()));
     }
     mediabox_t result;
-    for (size_t i = 0; i < result.size(); ++i) result[i] = stof(array_data.at(i).first);
+    for (size_t i = 0; i < result.size(); ++i) result[i] = stof(array_data.at(i).first.to_string());
     return result;
 }
 
@@ -696,20 +798,43 @@ optional<mediabox_t> PagesExtractor::get_box(const dict_t &dictionary,
     return parent_media_box;
 }
 
-string PagesExtractor::get_text()
+//converters reference cmaps of their extractor, so copy drops them to be used by another thread
+PagesExtractor PagesExtractor::clone() const
 {
-    string text;
-    for (unsigned int page_id : pages)
+    PagesExtractor result(*this);
+    //clone caches own form results, their size limit stays shared
+    result.form_results.clear();
+    for (auto &p : result.converter_engine_cache) p.second.clear();
+    result.cmap_cache.clear();
+    return result;
+}
+
+size_t PagesExtractor::get_pages_count() const
+{
+    return pages.size();
+}
+
+string PagesExtractor::get_page_text(size_t page_num)
+{
+    if (page_num >= pages.size())
     {
-        vector<pair<unsigned int, unsigned int>> contents_id_gen = get_contents_id_gen(storage.get_object(page_id));
-        string page_content;
-        unordered_set<unsigned int> visited_contents;
-        for (const pair<unsigned int, unsigned int> &id_gen : contents_id_gen)
-        {
-            page_content += output_content(visited_contents, doc, storage, id_gen, decrypt_data);
-        }
-        for (vector<text_chunk_t> &r : extract_text(page_content, to_string(page_id), boost::none)) text += render_text(r);
+        throw pdf_error(FUNC_STRING + "page " + to_string(page_num) + " is out of range. Pages count: " +
+                        to_string(pages.size()));
     }
+    unsigned int page_id = pages[page_num];
+    const string id_str = to_string(page_id);
+    //fonts keep the state of previous extraction, so they are built for every call
+    fonts.erase(id_str);
+    fonts.emplace(id_str, get_page_fonts(dicts.at(id_str)));
+    vector<pair<unsigned int, unsigned int>> contents_id_gen = get_contents_id_gen(storage.get_object(page_id));
+    string page_content;
+    unordered_set<unsigned int> visited_contents;
+    for (const pair<unsigned int, unsigned int> &id_gen : contents_id_gen)
+    {
+        page_content += output_content(visited_contents, doc, storage, id_gen);
+    }
+    string text;
+    for (vector<text_chunk_t> &r : extract_text(page_content, id_str, boost::none)) text += render_text(r);
     return text;
 }
 
@@ -742,20 +867,20 @@ ToUnicodeConverter PagesExtractor::get_to_unicode_converter(const dict_t &font_d
     {
         auto it2 = font_dict.find("/FontDescriptor");
         if (it2 == font_dict.end()) return ToUnicodeConverter();
-        const dict_t desc_dict = get_dict_or_indirect_dict(it2->second, storage);
-        auto it3 = desc_dict.find("/FontFile");
-        if (it3 != desc_dict.end() && font_dict.count("/Encoding") == 0)
+        const std::shared_ptr<const dict_t> desc_dict = get_dict_or_indirect_dict(it2->second, storage);
+        auto it3 = desc_dict->find("/FontFile");
+        if (it3 != desc_dict->end() && font_dict.count("/Encoding") == 0)
         {
             const pair<unsigned int, unsigned int> id_gen = get_id_gen(it3->second.first);
             if (!cmap_cache.count(id_gen.first)) cmap_cache.emplace(id_gen.first,
-                                                                    get_FontFile(doc, storage, id_gen, decrypt_data));
+                                                                    get_FontFile(doc, storage, id_gen));
             return ToUnicodeConverter(cmap_cache[id_gen.first]);
         }
-        it3 = desc_dict.find("/FontFile2");
-        if (it3 == desc_dict.end()) return ToUnicodeConverter();
+        it3 = desc_dict->find("/FontFile2");
+        if (it3 == desc_dict->end()) return ToUnicodeConverter();
         const pair<unsigned int, unsigned int> id_gen = get_id_gen(it3->second.first);
         if (!cmap_cache.count(id_gen.first)) cmap_cache.emplace(id_gen.first,
-                                                                get_FontFile2(doc, storage, id_gen, decrypt_data));
+                                                                get_FontFile2(doc, storage, id_gen));
         return ToUnicodeConverter(cmap_cache[id_gen.first]);
     }
     switch (it->second.second)
@@ -763,7 +888,7 @@ ToUnicodeConverter PagesExtractor::get_to_unicode_converter(const dict_t &font_d
     case INDIRECT_OBJECT:
     {
         const pair<unsigned int, unsigned int> id_gen = get_id_gen(it->second.first);
-        if (!cmap_cache.count(id_gen.first)) cmap_cache.emplace(id_gen.first,  get_cmap(doc, storage, id_gen, decrypt_data));
+        if (!cmap_cache.count(id_gen.first)) cmap_cache.emplace(id_gen.first,  get_cmap(doc, storage, id_gen));
         return ToUnicodeConverter(cmap_cache[id_gen.first]);
     }
     case NAME_OBJECT:
@@ -803,7 +928,7 @@ void PagesExtractor::do_BI(extract_argument_t &arg, size_t &i)
 void PagesExtractor::do_Tf(extract_argument_t &arg, size_t &i)
 {
     arg.coordinates.set_Tf(arg.st);
-    const string font = pop(arg.st).second;
+    const string font = arg.st.pop().data.to_string();
     fonts.at(arg.resource_id).set_current_font(font);
     arg.encoding = get_font_encoding(font, arg.resource_id);
 }
@@ -811,7 +936,7 @@ void PagesExtractor::do_Tf(extract_argument_t &arg, size_t &i)
 void PagesExtractor::do_Tj(extract_argument_t &arg, size_t &i)
 {
     if (!arg.in || !arg.encoding || arg.encoding->is_vertical()) return;
-    text_chunk_t chunk = arg.encoding->get_string(decode_string(pop(arg.st).second),
+    text_chunk_t chunk = arg.encoding->get_string(decode_string(arg.st.pop().data),
                                                   arg.coordinates,
                                                   0,
                                                   fonts.at(arg.resource_id));
@@ -827,7 +952,7 @@ void PagesExtractor::do_Tm(extract_argument_t &arg, size_t &i)
 void PagesExtractor::do_TJ(extract_argument_t &arg, size_t &i)
 {
     if (!arg.in || !arg.encoding || arg.encoding->is_vertical()) return;
-    vector<text_chunk_t> tj_texts = arg.encoding->get_strings_from_array(pop(arg.st).second,
+    vector<text_chunk_t> tj_texts = arg.encoding->get_strings_from_array(arg.st.pop().data,
                                                                          arg.coordinates,
                                                                          fonts.at(arg.resource_id));
     arg.result[0].insert(arg.result[0].end(),
@@ -855,22 +980,68 @@ void PagesExtractor::do_Td(extract_argument_t &arg, size_t &i)
 
 void PagesExtractor::do_Do(extract_argument_t &arg, size_t &i)
 {
-    const string XObject = pop(arg.st).second;
+    const string XObject = arg.st.pop().data.to_string();
     const string resource_name = get_resource_name(arg.resource_id, XObject);
     if (!get_XObject_data(arg.resource_id, XObject, resource_name)) return;
+    const unsigned int form_id = XObject_id_gens.at(resource_name).first;
+    //forms can draw themselves
+    if (form_depth == MAX_FORM_DEPTH || drawn_forms.count(form_id))
+    {
+        ++form_cuts;
+        return;
+    }
+    const matrix_t CTM = arg.coordinates.get_CTM();
+    if (cached_XObjects.count(resource_name) && is_scale_translate(CTM))
+    {
+        auto it = form_results.find(form_id);
+        if (it == form_results.end() && *form_results_size < MAX_FORM_RESULTS_SIZE)
+        {
+            const size_t cuts = form_cuts;
+            vector<vector<text_chunk_t>> result = extract_form(form_id,
+                                                               resource_name,
+                                                               XObject_matrices.at(resource_name));
+            if (form_cuts != cuts)
+            {
+                //text of the cut form depends on forms which draw it
+                for (const vector<text_chunk_t> &r : result) arg.result.push_back(transform_chunks(r, CTM));
+                return;
+            }
+            *form_results_size += get_chunks_size(result);
+            it = form_results.emplace(form_id, std::move(result)).first;
+        }
+        if (it != form_results.end())
+        {
+            for (const vector<text_chunk_t> &r : it->second) arg.result.push_back(transform_chunks(r, CTM));
+            return;
+        }
+    }
+    const matrix_t ctm = XObject_matrices.at(resource_name) * CTM;
+    for (vector<text_chunk_t> &r : extract_form(form_id, resource_name, ctm)) arg.result.push_back(std::move(r));
+}
+
+vector<vector<text_chunk_t>> PagesExtractor::extract_form(unsigned int form_id,
+                                                          const string &resource_name,
+                                                          const matrix_t &CTM)
+{
     auto it = XObject_streams.find(resource_name);
-    if (it != XObject_streams.end())
+    if (it == XObject_streams.end())
+    {
+        it = XObject_streams.emplace(resource_name, get_stream(doc, XObject_id_gens.at(resource_name), storage)).first;
+    }
+    //forms with own resources don`t inherit fonts of the page
+    if (!fonts.count(resource_name))
     {
-        const matrix_t ctm = XObject_matrices.at(resource_name) * arg.coordinates.get_CTM();
-        for (vector<text_chunk_t> &r : extract_text(it->second, resource_name, ctm)) arg.result.push_back(std::move(r));
+        fonts.emplace(resource_name, get_fonts(dicts.at(resource_name), Fonts(storage, dict_t())));
     }
+    FormGuard guard(drawn_forms, form_depth, form_id);
+    return extract_text(it->second, resource_name, CTM);
 }
 
 void PagesExtractor::do_quote(extract_argument_t &arg, size_t &i)
 {
     if (!arg.encoding || !arg.in) return;
     arg.coordinates.set_quote(arg.st);
-    arg.result[0].push_back(arg.encoding->get_string(decode_string(pop(arg.st).second),
+    arg.result[0].push_back(arg.encoding->get_string(decode_string(arg.st.pop().data),
                                                      arg.coordinates,
                                                      0,
                                                      fonts.at(arg.resource_id)));
@@ -907,7 +1078,7 @@ void PagesExtractor::do_T_star(extract_argument_t &arg, size_t &i)
 void PagesExtractor::do_double_quote(extract_argument_t &arg, size_t &i)
 {
     if (!arg.encoding || !arg.in) return;
-    const string str = pop(arg.st).second;
+    const string str = arg.st.pop().data.to_string();
     arg.coordinates.set_double_quote(arg.st);
     arg.result[0].push_back(arg.encoding->get_string(str, arg.coordinates, 0, fonts.at(arg.resource_id)));
 }
@@ -915,7 +1086,7 @@ void PagesExtractor::do_double_quote(extract_argument_t &arg, size_t &i)
 void PagesExtractor::do_Ts(extract_argument_t &arg, size_t &i)
 {
     if (!arg.in) return;
-    fonts.at(arg.resource_id).set_rise(stof(pop(arg.st).second));
+    fonts.at(arg.resource_id).set_rise(pop_number(arg.st));
 }
 
 void PagesExtractor::do_Tw(extract_argument_t &arg, size_t &i)
@@ -946,21 +1117,29 @@ vector<vector<text_chunk_t>> PagesExtractor::extract_text(const string &page_con
 {
     ConverterEngine *encoding = nullptr;
     Coordinates coordinates(CTM? *CTM : init_CTM(rotates.at(resource_id), media_boxes.at(resource_id)));
-    vector<pair<pdf_object_t, string>> st;
-    st.reserve(PDF_STRINGS_NUM);
+    operand_stack_t st;
     bool in = false;
     vector<vector<text_chunk_t>> result(1);
     result[0].reserve(PDF_STRINGS_NUM);
     extract_argument_t argument{result, encoding, st, coordinates, resource_id, in, page_content};
-    for (size_t i = skip_comments(page_content, 0, false);
-         i != string::npos && i < page_content.length();
-         i = skip_comments(page_content, i, false))
+    size_t i = 0;
+    bool after_operator = true;
+    while (true)
     {
-        if (in && put2stack(st, page_content, i)) continue;
-        string token = get_token(page_content, i);
-        extract_handler_t handler = get_extract_handler(token);
+        //path, color and other graphics operators outside of text objects aren`t tokenized
+        if (!in && after_operator) i = skim_graphics(page_content, i);
+        content_token_t token = get_content_token(page_content, i);
+        if (token.op == OP_END) break;
+        after_operator = token.op != OP_NONE;
+        if (token.op == OP_NONE)
+        {
+            st.push(token.operand);
+            continue;
+        }
+        extract_handler_t handler = EXTRACT_HANDLERS[token.op];
         if (handler) (this->*handler)(argument, i);
-        else st.emplace_back(VALUE, std::move(token));
+        //operands of operators without handlers are dropped too
+        st.clear();
     }
 
     return result;
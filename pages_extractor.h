@@ -3,6 +3,8 @@
 
 #include <string>
 #include <utility>
+#include <memory>
+#include <atomic>
 
 #include <unordered_set>
 #include <unordered_map>
@@ -17,6 +19,7 @@
 #include "diff_converter.h"
 #include "to_unicode_converter.h"
 #include "converter_engine.h"
+#include "content_lexer.h"
 
 enum {RECTANGLE_ELEMENTS_NUM = 4};
 using mediabox_t = std::array<float, RECTANGLE_ELEMENTS_NUM>;
@@ -26,14 +29,15 @@ class PagesExtractor
 public:
     PagesExtractor(unsigned int catalog_pages_id,
                    const ObjectStorage &storage_arg,
-                   const dict_t &decrypt_data_arg,
-                   const std::string &doc_arg);
-    std::string get_text();
+                   boost::string_view doc_arg);
+    PagesExtractor clone() const;
+    size_t get_pages_count() const;
+    std::string get_page_text(size_t page_num);
     struct extract_argument_t
     {
         std::vector<std::vector<text_chunk_t>> &result;
         ConverterEngine *encoding;
-        std::vector<std::pair<pdf_object_t, std::string>> &st;
+        operand_stack_t &st;
         Coordinates &coordinates;
         const std::string &resource_id;
         bool &in;
@@ -72,18 +76,23 @@ private:
                                                         const boost::optional<matrix_t> CTM);
     void get_pages_resources_int(std::unordered_set<unsigned int> &checked_nodes,
                                  const dict_t &parent_dict,
-                                 const Fonts &parent_fonts,
+                                 const boost::optional<std::pair<std::string, pdf_object_t>> &parent_resources,
                                  const boost::optional<mediabox_t> &parent_media_box,
                                  unsigned int parent_rotate);
     Fonts get_fonts(const dict_t &dictionary, const Fonts &parent_fonts) const;
+    Fonts get_page_fonts(const dict_t &page_dict);
     ConverterEngine* get_font_encoding(const std::string &font, const std::string &resource_id);
     boost::optional<std::pair<std::string, pdf_object_t>> get_encoding(const dict_t &font_dict) const;
     bool get_XObject_data(const std::string &page_id, const std::string &XObject_name, const std::string &resource_name);
+    std::vector<std::vector<text_chunk_t>> extract_form(unsigned int form_id,
+                                                        const std::string &resource_name,
+                                                        const matrix_t &CTM);
 private:
-    const std::string &doc;
+    const boost::string_view doc;
     const ObjectStorage &storage;
-    const dict_t &decrypt_data;
     std::unordered_map<std::string, Fonts> fonts;
+    //fonts are built on first use of /Resources value, pages usually share inherited resources
+    std::unordered_map<std::string, Fonts> resources_fonts;
     std::vector<unsigned int> pages;
     std::unordered_map<std::string, dict_t> dicts;
     std::unordered_map<std::string, mediabox_t> media_boxes;
@@ -93,6 +102,17 @@ private:
     std::unordered_map<std::string, matrix_t> XObject_matrices;
     std::unordered_map<unsigned int, cmap_t> cmap_cache;
     std::unordered_map<std::string, dict_t> XObjects_cache;
+    std::unordered_map<std::string, std::pair<unsigned int, unsigned int>> XObject_id_gens;
+    //forms with own /Resources don`t depend on the invoking page, their text is extracted once for the document
+    std::unordered_set<std::string> cached_XObjects;
+    std::unordered_map<unsigned int, std::vector<std::vector<text_chunk_t>>> form_results;
+    //shared by the extractor and its clones, so the limit is for the document, not for every thread
+    std::shared_ptr<std::atomic<size_t>> form_results_size;
+    //ids of forms being extracted, Do of them is cut
+    std::unordered_set<unsigned int> drawn_forms;
+    unsigned int form_depth;
+    //Do cut so far, form text is cached only if its extraction had no cuts
+    size_t form_cuts;
 };
 
 #endif //PAGES_EXTRACTOR_H
@@ -4,10 +4,19 @@
 #include <utility>
 #include <vector>
 #include <unordered_set>
+#include <algorithm>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <thread>
+#include <functional>
+#include <memory>
 
 #include "common.h"
 #include "object_storage.h"
 #include "pages_extractor.h"
+#include "pdf_extractor.h"
+#include "mapped_file.h"
 
 using namespace std;
 
@@ -15,18 +24,26 @@ enum
 {
     CROSS_REFERENCE_LINE_SIZE = 20,
     BYTE_OFFSET_LEN = 10, /* length for byte offset in cross reference record */
-    GENERATION_NUMBER_LEN = 5 /* length for generation number */
+    GENERATION_NUMBER_LEN = 5, /* length for generation number */
+    MAX_OBJECT_ID = 8388607, /* C.2 Architectural limits. Indirect objects in a PDF file */
+    MAX_GENERATION_NUMBER = 65535, /* 7.3.10. Indirect Objects */
+    PAGES_WINDOW_PER_THREAD = 2 /* extracted pages which can wait for sink per thread */
 };
 
-void get_object_offsets_old(const string &buffer, size_t offset, vector<size_t> &result);
-void get_object_offsets_new(const string &buffer, size_t offset, vector<size_t> &result);
+using compressed_entries_t = vector<pair<size_t, xref_entry_t>>;
 
-bool is_prefix(const char *str, const char *pre)
+void get_object_offsets_old(boost::string_view buffer, size_t offset, vector<size_t> &result);
+void get_object_offsets_new(boost::string_view buffer,
+                            size_t offset,
+                            vector<size_t> &result,
+                            compressed_entries_t &compressed);
+
+bool is_prefix(boost::string_view buffer, size_t offset, const char *pre)
 {
-    return strncmp(str, pre, strlen(pre)) == 0;
+    return offset <= buffer.length() && buffer.substr(offset).starts_with(pre);
 }
 
-size_t get_cross_ref_offset(const string &buffer)
+size_t get_cross_ref_offset(boost::string_view buffer)
 {
     size_t offset_start = buffer.rfind("startxref");
     if (offset_start == string::npos) throw pdf_error(FUNC_STRING + "can`t find startxref");
@@ -34,7 +51,7 @@ size_t get_cross_ref_offset(const string &buffer)
     offset_start = skip_comments(buffer, offset_start);
     size_t offset_end = buffer.find_first_not_of("0123456789", offset_start);
     if (offset_end == string::npos) throw pdf_error(FUNC_STRING + "can`t find end of trailer offset number");
-    size_t r = strict_stoul(buffer.substr(offset_start, offset_end - offset_start));
+    size_t r = strict_stoul(buffer.substr(offset_start, offset_end - offset_start).to_string());
     if (r >= buffer.size())
     {
         throw pdf_error(FUNC_STRING + to_string(r) + " is larger than buffer size " + to_string(buffer.size()));
@@ -43,14 +60,14 @@ size_t get_cross_ref_offset(const string &buffer)
     return r;
 }
 
-void append_object(const string &buf, size_t offset, vector<size_t> &objects)
+void append_object(boost::string_view buf, size_t offset, vector<size_t> &objects)
 {
     if (offset + BYTE_OFFSET_LEN >= buf.length()) throw pdf_error(FUNC_STRING + "object info record is too small");
     if (buf[offset + BYTE_OFFSET_LEN] != ' ') throw pdf_error(FUNC_STRING + "no space for object info");
-    objects.push_back(strict_stoul(buf.substr(offset, BYTE_OFFSET_LEN)));
+    objects.push_back(strict_stoul(buf.substr(offset, BYTE_OFFSET_LEN).to_string()));
 }
 
-char get_object_status(const string &buffer, size_t offset)
+char get_object_status(boost::string_view buffer, size_t offset)
 {
     size_t start_offset = offset + BYTE_OFFSET_LEN + GENERATION_NUMBER_LEN + 1;
     if (start_offset + 2 >= buffer.length()) throw pdf_error(FUNC_STRING + "object info record is too small");
@@ -65,18 +82,18 @@ char get_object_status(const string &buffer, size_t offset)
     return ret;
 }
 
-size_t get_xref_number(const string &buffer, size_t &offset)
+size_t get_xref_number(boost::string_view buffer, size_t &offset)
 {
     offset = efind_first(buffer, "\r\t\n ", offset);
     offset = skip_spaces(buffer, offset);
     size_t end_offset = efind_first(buffer, "\r\t\n ", offset);
-    size_t result = strict_stoul(buffer.substr(offset, end_offset - offset));
+    size_t result = strict_stoul(buffer.substr(offset, end_offset - offset).to_string());
     offset = skip_spaces(buffer, end_offset);
 
     return result;
 }
 
-vector<pair<size_t, size_t>> get_trailer_offsets_old(const string &buffer, size_t cross_ref_offset)
+vector<pair<size_t, size_t>> get_trailer_offsets_old(boost::string_view buffer, size_t cross_ref_offset)
 {
     vector<pair<size_t, size_t>> trailer_offsets;
     unordered_set<size_t> cross_ref_offsets{cross_ref_offset};
@@ -92,11 +109,11 @@ vector<pair<size_t, size_t>> get_trailer_offsets_old(const string &buffer, size_
         trailer_offsets.emplace_back(cross_ref_offset, end_offset);
         size_t trailer_offset = efind(buffer, "trailer", cross_ref_offset);
         trailer_offset += LEN("trailer");
-        const dict_t data = get_dictionary_data(buffer, trailer_offset);
+        const dict_view_t data = get_dictionary_data_view(buffer, trailer_offset);
         auto it = data.find("/Prev");
         if (it == data.end()) break;
         if (it->second.second != VALUE) throw pdf_error(FUNC_STRING + "/Prev value is not PDF VALUE type");
-        cross_ref_offset = strict_stoul(it->second.first);
+        cross_ref_offset = strict_stoul(it->second.first.to_string());
         //protect from endless loop
         if (cross_ref_offsets.count(cross_ref_offset)) break;
         cross_ref_offsets.insert(cross_ref_offset);
@@ -105,7 +122,7 @@ vector<pair<size_t, size_t>> get_trailer_offsets_old(const string &buffer, size_
     return trailer_offsets;
 }
 
-vector<pair<size_t, size_t>> get_trailer_offsets_new(const string &buffer, size_t cross_ref_offset)
+vector<pair<size_t, size_t>> get_trailer_offsets_new(boost::string_view buffer, size_t cross_ref_offset)
 {
     vector<pair<size_t, size_t>> trailer_offsets;
     unordered_set<size_t> cross_ref_offsets{cross_ref_offset};
@@ -120,11 +137,11 @@ vector<pair<size_t, size_t>> get_trailer_offsets_new(const string &buffer, size_
         }
         trailer_offsets.emplace_back(cross_ref_offset, end_offset);
         size_t dict_offset = efind(buffer, "<<", cross_ref_offset);
-        const dict_t data = get_dictionary_data(buffer, dict_offset);
+        const dict_view_t data = get_dictionary_data_view(buffer, dict_offset);
         auto it = data.find("/Prev");
         if (it == data.end()) break;
         if (it->second.second != VALUE) throw pdf_error(FUNC_STRING + "/Prev value is not PDF VALUE type");
-        cross_ref_offset = strict_stoul(it->second.first);
+        cross_ref_offset = strict_stoul(it->second.first.to_string());
         if (cross_ref_offsets.count(cross_ref_offset)) break;
         cross_ref_offsets.insert(cross_ref_offset);
     }
@@ -133,17 +150,17 @@ vector<pair<size_t, size_t>> get_trailer_offsets_new(const string &buffer, size_
 }
 
 
-vector<pair<size_t, size_t>> get_trailer_offsets(const string &buffer, size_t cross_ref_offset)
+vector<pair<size_t, size_t>> get_trailer_offsets(boost::string_view buffer, size_t cross_ref_offset)
 {
-    if (is_prefix(buffer.data() + cross_ref_offset, "xref")) return get_trailer_offsets_old(buffer, cross_ref_offset);
+    if (is_prefix(buffer, cross_ref_offset, "xref")) return get_trailer_offsets_old(buffer, cross_ref_offset);
     return get_trailer_offsets_new(buffer, cross_ref_offset);
 }
 
-void get_object_offsets(const string &buffer, size_t offset, vector<size_t> &result)
+void get_object_offsets(boost::string_view buffer, size_t offset, vector<size_t> &result, compressed_entries_t &compressed)
 {
     offset = skip_comments(buffer, offset);
-    if (is_prefix(buffer.data() + offset, "xref")) return get_object_offsets_old(buffer, offset, result);
-    get_object_offsets_new(buffer, offset, result);
+    if (is_prefix(buffer, offset, "xref")) return get_object_offsets_old(buffer, offset, result);
+    get_object_offsets_new(buffer, offset, result, compressed);
 }
 
 array<unsigned int, 3> get_w(const dict_t &dictionary_data)
@@ -209,67 +226,77 @@ array<uint64_t, 3> get_cross_reference_entry(const string &stream, size_t &offse
     return result;
 }
 
-unsigned int get_cross_ref_entries(const dict_t dictionary_data,
-                                   const array<unsigned int, 3> &w,
-                                   size_t length)
+//returns pairs of (first object number, number of entries) for every subsection
+vector<pair<size_t, size_t>> get_cross_ref_subsections(const dict_t &dictionary_data)
 {
     auto it = dictionary_data.find("/Index");
     if (it == dictionary_data.end())
     {
         const pair<string, pdf_object_t> &val = dictionary_data.at("/Size");
         if (val.second != VALUE) throw pdf_error(FUNC_STRING + "/Size must have VALUE type");
-        return strict_stoul(val.first);
+        return vector<pair<size_t, size_t>>{make_pair(0, strict_stoul(val.first))};
     }
     if (it->second.second != ARRAY) throw pdf_error("/Index must be ARRAY");
-    unsigned int entries = 0;
+    vector<pair<size_t, size_t>> subsections;
     vector<pair<string, pdf_object_t>> array_data = get_array_data(it->second.first, 0);
     if (array_data.empty()) throw pdf_error(FUNC_STRING + "/Index array is empty");
     for (size_t i = 0; i < array_data.size() - 1; i += 2)
     {
-        if (array_data[i + 1].second != VALUE) throw pdf_error(FUNC_STRING + "wrong type for /Index. type=" +
-                                                               to_string(array_data[i + 1].second) +
-                                                               " val=" + array_data[i + 1].first);
-        entries += strict_stoul(array_data[i + 1].first);
+        for (size_t j = i; j < i + 2; ++j)
+        {
+            if (array_data[j].second != VALUE) throw pdf_error(FUNC_STRING + "wrong type for /Index. type=" +
+                                                               to_string(array_data[j].second) +
+                                                               " val=" + array_data[j].first);
+        }
+        subsections.emplace_back(strict_stoul(array_data[i].first), strict_stoul(array_data[i + 1].first));
     }
-    return entries;
+    return subsections;
 }
 
 void get_offsets_internal_new(const string &stream,
                               const dict_t dictionary_data,
-                              vector<size_t> &result)
+                              vector<size_t> &result,
+                              compressed_entries_t &compressed)
 {
     //7.5.8.3. Cross-Reference Stream Data
     array<unsigned int, 3> w = get_w(dictionary_data);
     size_t offset = 0;
-    for (unsigned int i = 0, n = get_cross_ref_entries(dictionary_data, w, stream.length()); i < n; ++i)
+    for (const pair<size_t, size_t> &subsection : get_cross_ref_subsections(dictionary_data))
     {
-        array<uint64_t, 3> entry = get_cross_reference_entry(stream, offset, w);
-        if (entry[0] == 1) result.push_back(entry[1]);
+        for (size_t id = subsection.first; id < subsection.first + subsection.second; ++id)
+        {
+            array<uint64_t, 3> entry = get_cross_reference_entry(stream, offset, w);
+            if (entry[0] == 1) result.push_back(entry[1]);
+            //compressed object: object number of object stream and index of object within it
+            else if (entry[0] == 2) compressed.emplace_back(id, xref_entry_t(xref_entry_t::COMPRESSED, entry[1]));
+        }
     }
 }
 
-void get_object_offsets_new(const string &buffer, size_t offset, vector<size_t> &result)
+void get_object_offsets_new(boost::string_view buffer,
+                            size_t offset,
+                            vector<size_t> &result,
+                            compressed_entries_t &compressed)
 {
     offset = efind(buffer, "<<", offset);
-    string dict = get_dictionary(buffer, offset);
-    dict_t dictionary_data = get_dictionary_data(dict, 0);
+    dict_t dictionary_data = get_dictionary_data(get_dictionary_view(buffer, offset), 0);
     auto it = dictionary_data.find("/Length");
     if (it == dictionary_data.end()) throw pdf_error("can`t find /Length");
     if (it->second.second != VALUE) throw pdf_error("/Length value must have VALUE type");
     size_t length = strict_stoul(it->second.first);
     string content = get_content(buffer, length, offset);
-    content = decode(content, dictionary_data);
-    get_offsets_internal_new(content, dictionary_data, result);
+    content = decode(std::move(content), dictionary_data);
+    get_offsets_internal_new(content, dictionary_data, result, compressed);
 }
 
-void get_object_offsets_old(const string &buffer, size_t offset, vector<size_t> &result)
+void get_object_offsets_old(boost::string_view buffer, size_t offset, vector<size_t> &result)
 {
     offset = efind(buffer, "xref", offset);
     offset += LEN("xref");
     while (true)
     {
         offset = skip_comments(buffer, offset);
-        if (is_prefix(buffer.data() + offset, "trailer")) return;
+        if (is_prefix(buffer, offset, "trailer")) return;
         size_t n = get_xref_number(buffer, offset);
         for (size_t i = 0 ; i < n; offset += CROSS_REFERENCE_LINE_SIZE, ++i)
         {
@@ -279,7 +306,7 @@ void get_object_offsets_old(const string &buffer, size_t offset, vector<size_t>
     }
 }
 
-void validate_offsets(const string &buffer, const vector<size_t> &offsets)
+void validate_offsets(boost::string_view buffer, const vector<size_t> &offsets)
 {
     for (size_t offset : offsets)
     {
@@ -287,61 +314,86 @@ void validate_offsets(const string &buffer, const vector<size_t> &offsets)
     }
 }
 
-vector<size_t> get_all_object_offsets(const string &buffer,
-                                      size_t cross_ref_offset,
-                                      const vector<pair<size_t, size_t>> &trailer_offsets)
+//7.5.5. File Trailer. /Size is one greater than the highest object number in the file.
+//Broken files often have too small /Size, so it is only a hint for reserving the table
+size_t get_xref_size(boost::string_view buffer, const vector<pair<size_t, size_t>> &trailer_offsets)
 {
-    vector<size_t> object_offsets;
+    size_t result = 0;
     for (const pair<size_t, size_t> &p : trailer_offsets)
     {
-        get_object_offsets(buffer, p.first, object_offsets);
+        size_t offset = is_prefix(buffer, p.first, "xref")? efind(buffer, "trailer", p.first) + LEN("trailer") :
+                                                            efind(buffer, "<<", p.first);
+        const dict_view_t data = get_dictionary_data_view(buffer, offset);
+        auto it = data.find("/Size");
+        if (it == data.end() || it->second.second != VALUE) continue;
+        result = max(result, strict_stoul(it->second.first.to_string()));
     }
-    validate_offsets(buffer, object_offsets);
+    //every object takes at least one byte of the file
+    return min<size_t>({result, MAX_OBJECT_ID + 1, buffer.size()});
+}
 
-    return object_offsets;
+void insert_xref_entry(xref_t &xref, size_t id, const xref_entry_t &entry)
+{
+    //C.2 Architectural limits. One broken cross-reference entry doesn`t prevent extraction of other objects
+    if (id > MAX_OBJECT_ID) return;
+    if (id >= xref.size()) xref.resize(id + 1);
+    //cross-reference sections are processed from the newest one, so keep the first entry
+    if (xref[id].type == xref_entry_t::FREE) xref[id] = entry;
 }
 
-map<size_t, size_t> get_id2offsets(const string &buffer,
-                                   size_t cross_ref_offset,
-                                   const vector<pair<size_t, size_t>> &trailer_offsets)
+xref_t get_xref(boost::string_view buffer, const vector<pair<size_t, size_t>> &trailer_offsets)
 {
-    vector<size_t> offsets = get_all_object_offsets(buffer, cross_ref_offset, trailer_offsets);
-    map<size_t, size_t> id2offsets;
-    for (size_t offset : offsets)
+    xref_t xref;
+    xref.reserve(get_xref_size(buffer, trailer_offsets));
+    for (const pair<size_t, size_t> &p : trailer_offsets)
     {
-        size_t start_offset = efind_number(buffer, skip_comments(buffer, offset));
-        size_t end_offset = efind_first(buffer, " \r\n\t", start_offset);
-        id2offsets.emplace(strict_stoul(buffer.substr(start_offset, end_offset - start_offset)), offset);
+        vector<size_t> offsets;
+        compressed_entries_t compressed;
+        get_object_offsets(buffer, p.first, offsets, compressed);
+        validate_offsets(buffer, offsets);
+        for (size_t offset : offsets)
+        {
+            size_t start_offset = efind_number(buffer, skip_comments(buffer, offset));
+            size_t end_offset = efind_first(buffer, " \r\n\t", start_offset);
+            size_t id = strict_stoul(buffer.substr(start_offset, end_offset - start_offset).to_string());
+            start_offset = efind_number(buffer, end_offset);
+            end_offset = efind_first(buffer, " \r\n\t", start_offset);
+            size_t gen = strict_stoul(buffer.substr(start_offset, end_offset - start_offset).to_string());
+            if (gen > MAX_GENERATION_NUMBER) throw pdf_error(FUNC_STRING + "generation number " + to_string(gen) +
+                                                             " is too large");
+            insert_xref_entry(xref, id, xref_entry_t(xref_entry_t::IN_USE, offset, gen));
+        }
+        for (const pair<size_t, xref_entry_t> &entry : compressed)
+        {
+            insert_xref_entry(xref, entry.first, entry.second);
+        }
     }
 
-    return id2offsets;
+    return xref;
 }
 
-string get_text(const string &buffer,
-                size_t cross_ref_offset,
-                const ObjectStorage &storage,
-                const dict_t &decrypt_data)
+unsigned int get_pages_id(boost::string_view buffer, size_t cross_ref_offset, const ObjectStorage &storage)
 {
     size_t trailer_offset = cross_ref_offset;
-    if (is_prefix(buffer.data() + cross_ref_offset, "xref"))
+    if (is_prefix(buffer, cross_ref_offset, "xref"))
     {
         trailer_offset = efind(buffer, "trailer", trailer_offset);
         trailer_offset += LEN("trailer");
     }
-    const dict_t trailer_data = get_dictionary_data(buffer, trailer_offset);
-    const pair<string, pdf_object_t> root_pair = trailer_data.at("/Root");
+    const dict_view_t trailer_data = get_dictionary_data_view(buffer, trailer_offset);
+    const pair<boost::string_view, pdf_object_t> &root_pair = trailer_data.at("/Root");
     if (root_pair.second != INDIRECT_OBJECT) throw pdf_error(FUNC_STRING + "/Root value must be INDIRECT_OBJECT");
     const pair<string, pdf_object_t> real_root_pair = storage.get_object(get_id_gen(root_pair.first).first);
     if (real_root_pair.second != DICTIONARY) throw pdf_error(FUNC_STRING + "/Root indirect object must be a dictionary");
 
-    const dict_t root_data = get_dictionary_data(real_root_pair.first, 0);
-    const pair<string, pdf_object_t> pages_pair = root_data.at("/Pages");
+    const dict_view_t root_data = get_dictionary_data_view(real_root_pair.first, 0);
+    const pair<boost::string_view, pdf_object_t> &pages_pair = root_data.at("/Pages");
     if (pages_pair.second != INDIRECT_OBJECT) throw pdf_error(FUNC_STRING + "/Pages value must be INDRECT_OBJECT");
 
-    return PagesExtractor(get_id_gen(pages_pair.first).first, storage, decrypt_data, buffer).get_text();
+    return get_id_gen(pages_pair.first).first;
 }
 
-pair<string, pair<string, pdf_object_t>> get_id(const string &buffer, size_t start, size_t end)
+pair<string, pair<string, pdf_object_t>> get_id(boost::string_view buffer, size_t start, size_t end)
 {
     size_t off = efind(buffer, "/ID", start);
     if (off >= end) throw pdf_error(FUNC_STRING + "Can`t find /ID key");
@@ -351,7 +403,7 @@ pair<string, pair<string, pdf_object_t>> get_id(const string &buffer, size_t sta
     return make_pair(string("/ID"), make_pair(get_array(buffer, off), ARRAY));
 }
 
-dict_t get_encrypt_data(const string &buffer, size_t start, size_t end, const map<size_t, size_t> &id2offsets)
+dict_t get_encrypt_data(boost::string_view buffer, size_t start, size_t end, const xref_t &xref)
 {
     size_t off = buffer.find("/Encrypt", start);
     if (off == string::npos || off >= end) return dict_t();
@@ -369,8 +421,8 @@ dict_t get_encrypt_data(const string &buffer, size_t start, size_t end, const ma
     {
         size_t end_off = efind_first(buffer, "\r\t\n ", off);
         const pair<string, pdf_object_t> encrypt_pair = get_object(buffer,
-                                                                   strict_stoul(buffer.substr(off, end_off - off)),
-                                                                   id2offsets);
+                                                                   strict_stoul(buffer.substr(off, end_off - off).to_string()),
+                                                                   xref);
         if (encrypt_pair.second != DICTIONARY) throw pdf_error(FUNC_STRING + "Encrypt indirect object must be DICTIONARY");
         result = get_dictionary_data(encrypt_pair.first, 0);
         break;
@@ -386,15 +438,212 @@ dict_t get_encrypt_data(const string &buffer, size_t start, size_t end, const ma
     return result;
 }
 
-string pdf2txt(const string &buffer)
+struct PdfDocument::Impl
+{
+    Impl(boost::string_view buffer,
+         size_t cross_ref_offset,
+         const vector<pair<size_t, size_t>> &trailer_offsets,
+         xref_t &&xref,
+         unique_ptr<MappedFile> &&mapped_file_arg,
+         size_t cache_capacity) :
+         mapped_file(std::move(mapped_file_arg)),
+         //xref is moved by constructor of storage, so it is still valid for encryption dictionary
+         storage(buffer,
+                 std::move(xref),
+                 get_encrypt_data(buffer, trailer_offsets.at(0).first, trailer_offsets.at(0).second, xref),
+                 cache_capacity),
+         extractor(get_pages_id(buffer, cross_ref_offset, storage), storage, buffer)
+    {
+    }
+
+    static unique_ptr<Impl> create(boost::string_view buffer, unique_ptr<MappedFile> &&mapped_file, size_t cache_capacity)
+    {
+        size_t cross_ref_offset = get_cross_ref_offset(buffer);
+        const vector<pair<size_t, size_t>> trailer_offsets = get_trailer_offsets(buffer, cross_ref_offset);
+        return unique_ptr<Impl>(new Impl(buffer,
+                                         cross_ref_offset,
+                                         trailer_offsets,
+                                         get_xref(buffer, trailer_offsets),
+                                         std::move(mapped_file),
+                                         cache_capacity));
+    }
+
+    //must be destroyed last, other members point to mapped data
+    const unique_ptr<MappedFile> mapped_file;
+    ObjectStorage storage;
+    PagesExtractor extractor;
+};
+
+PdfDocument::PdfDocument(const string &buffer, size_t cache_capacity /*= DEFAULT_CACHE_CAPACITY*/) :
+                         impl(Impl::create(buffer, nullptr, cache_capacity))
+{
+}
+
+PdfDocument::PdfDocument(const char *data, size_t size, size_t cache_capacity /*= DEFAULT_CACHE_CAPACITY*/) :
+                         impl(Impl::create(boost::string_view(data, size), nullptr, cache_capacity))
+{
+}
+
+PdfDocument::PdfDocument(unique_ptr<Impl> &&impl_arg) : impl(std::move(impl_arg))
+{
+}
+
+PdfDocument PdfDocument::map_file(const string &path, size_t cache_capacity /*= DEFAULT_CACHE_CAPACITY*/)
+{
+    unique_ptr<MappedFile> mapped_file(new MappedFile(path));
+    boost::string_view buffer = mapped_file->get_data();
+    return PdfDocument(Impl::create(buffer, std::move(mapped_file), cache_capacity));
+}
+
+PdfDocument PdfDocument::map_file(int fd, size_t cache_capacity /*= DEFAULT_CACHE_CAPACITY*/)
+{
+    unique_ptr<MappedFile> mapped_file(new MappedFile(fd));
+    boost::string_view buffer = mapped_file->get_data();
+    return PdfDocument(Impl::create(buffer, std::move(mapped_file), cache_capacity));
+}
+
+PdfDocument::PdfDocument(PdfDocument &&other) noexcept = default;
+
+PdfDocument& PdfDocument::operator=(PdfDocument &&other) noexcept = default;
+
+PdfDocument::~PdfDocument() = default;
+
+size_t PdfDocument::get_pages_count() const
+{
+    return impl->extractor.get_pages_count();
+}
+
+size_t PdfDocument::get_skipped_bytes() const
+{
+    return impl->storage.get_skipped_bytes();
+}
+
+size_t PdfDocument::get_cache_hits() const
+{
+    return impl->storage.get_cache_hits();
+}
+
+size_t PdfDocument::get_cache_misses() const
+{
+    return impl->storage.get_cache_misses();
+}
+
+string PdfDocument::get_page_text(size_t page_num)
+{
+    return impl->extractor.get_page_text(page_num);
+}
+
+void PdfDocument::extract_pages(const page_sink_t &sink, unsigned int threads_num /*= 1*/)
+{
+    const size_t pages_count = get_pages_count();
+    threads_num = min<size_t>(threads_num, pages_count);
+    if (threads_num <= 1)
+    {
+        for (size_t i = 0; i < pages_count; ++i) sink(i, get_page_text(i));
+        return;
+    }
+    //pages are passed to sink in order, workers can`t run ahead of sink more than window pages
+    const size_t window = threads_num * PAGES_WINDOW_PER_THREAD;
+    mutex pages_mutex;
+    condition_variable pages_cv;
+    map<size_t, string> ready_pages;
+    size_t next_page = 0, next_sink_page = 0, error_page = pages_count;
+    exception_ptr error;
+    bool stopped = false;
+    auto extract = [&](PagesExtractor &extractor)
+    {
+        while (true)
+        {
+            size_t page_num;
+            {
+                unique_lock<mutex> lock(pages_mutex);
+                pages_cv.wait(lock, [&] { return stopped || next_page >= pages_count ||
+                                                 next_page < next_sink_page + window; });
+                if (stopped || next_page >= pages_count) return;
+                //pages are taken in order, so all pages before failed one are extracted
+                page_num = next_page++;
+            }
+            string text;
+            exception_ptr page_error;
+            try
+            {
+                text = extractor.get_page_text(page_num);
+            }
+            catch (...)
+            {
+                page_error = current_exception();
+            }
+            lock_guard<mutex> lock(pages_mutex);
+            if (page_error)
+            {
+                if (page_num < error_page)
+                {
+                    error_page = page_num;
+                    error = page_error;
+                }
+                stopped = true;
+            }
+            else
+            {
+                ready_pages.emplace(page_num, std::move(text));
+            }
+            pages_cv.notify_all();
+        }
+    };
+    //every thread has own interpreter state, object storage is shared
+    vector<PagesExtractor> extractors;
+    for (unsigned int i = 1; i < threads_num; ++i) extractors.push_back(impl->extractor.clone());
+    vector<thread> threads;
+    threads.reserve(threads_num);
+    //threads which are already started are stopped and joined if next one can`t be started
+    try
+    {
+        threads.emplace_back(extract, ref(impl->extractor));
+        for (PagesExtractor &extractor : extractors) threads.emplace_back(extract, ref(extractor));
+        while (next_sink_page < pages_count)
+        {
+            string text;
+            {
+                unique_lock<mutex> lock(pages_mutex);
+                pages_cv.wait(lock, [&] { return ready_pages.count(next_sink_page) || error_page == next_sink_page; });
+                if (error_page == next_sink_page) break;
+                auto it = ready_pages.find(next_sink_page);
+                text = std::move(it->second);
+                ready_pages.erase(it);
+            }
+            sink(next_sink_page, text);
+            lock_guard<mutex> lock(pages_mutex);
+            ++next_sink_page;
+            pages_cv.notify_all();
+        }
+    }
+    catch (...)
+    {
+        {
+            lock_guard<mutex> lock(pages_mutex);
+            stopped = true;
+        }
+        pages_cv.notify_all();
+        for (thread &t : threads) t.join();
+        throw;
+    }
+    for (thread &t : threads) t.join();
+    if (error) rethrow_exception(error);
+}
+
+string PdfDocument::get_text(unsigned int threads_num /*= 1*/)
+{
+    string text;
+    extract_pages([&text](size_t, const string &page_text) { text += page_text; }, threads_num);
+    return text;
+}
+
+string pdf2txt(const string &buffer, unsigned int threads_num /*= 1*/)
+{
+    return PdfDocument(buffer).get_text(threads_num);
+}
+
+string pdf_file2txt(const string &path, unsigned int threads_num /*= 1*/)
 {
-    size_t cross_ref_offset = get_cross_ref_offset(buffer);
-    const vector<pair<size_t, size_t>> trailer_offsets = get_trailer_offsets(buffer, cross_ref_offset);
-    map<size_t, size_t> id2offsets = get_id2offsets(buffer, cross_ref_offset, trailer_offsets);
-    const dict_t encrypt_data = get_encrypt_data(buffer,
-                                                 trailer_offsets.at(0).first,
-                                                 trailer_offsets.at(0).second,
-                                                 id2offsets);
-    ObjectStorage storage(buffer, std::move(id2offsets), encrypt_data);
-    return get_text(buffer, cross_ref_offset, storage, encrypt_data);
+    return PdfDocument::map_file(path).get_text(threads_num);
 }
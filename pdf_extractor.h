@@ -2,7 +2,58 @@
 #define PDF_EXTRACTOR_H
 
 #include <string>
+#include <map>
+#include <memory>
+#include <cstddef>
+#include <functional>
 
-std::string pdf2txt(const std::string &buffer);
+//threads_num > 1 extracts pages concurrently, output is the same as for one thread
+std::string pdf2txt(const std::string &buffer, unsigned int threads_num = 1);
+//pdf file is mapped to memory instead of reading, parts of file which aren`t needed for text aren`t loaded
+std::string pdf_file2txt(const std::string &path, unsigned int threads_num = 1);
+
+//decodes the whole data of a stream. params are /DecodeParms entries of the filter,
+//keys include '/' and values are written as in the document
+using stream_filter_t = std::function<std::string(const std::string &data,
+                                                  const std::map<std::string, std::string> &params)>;
+//adds filter which isn`t supported by the library or replaces a standard one. name includes '/', e.g. "/JBIG2Decode".
+//Registry isn`t synchronized, so filters must be registered at startup, before documents are parsed
+void register_stream_filter(const std::string &name, const stream_filter_t &filter);
+
+//receives text of every page in page order. page_num starts from 0
+using page_sink_t = std::function<void(size_t page_num, const std::string &text)>;
+
+//document handle for page level extraction.
+//buffer must outlive the document, only objects needed for requested pages are decoded
+class PdfDocument
+{
+public:
+    //cache_capacity is number of parsed dictionaries and arrays(fonts, resources etc) kept by document
+    enum { DEFAULT_CACHE_CAPACITY = 1024 };
+
+    explicit PdfDocument(const std::string &buffer, size_t cache_capacity = DEFAULT_CACHE_CAPACITY);
+    PdfDocument(const char *data, size_t size, size_t cache_capacity = DEFAULT_CACHE_CAPACITY);
+    //document owns the mapping. fd isn`t closed and can be closed right after call
+    static PdfDocument map_file(const std::string &path, size_t cache_capacity = DEFAULT_CACHE_CAPACITY);
+    static PdfDocument map_file(int fd, size_t cache_capacity = DEFAULT_CACHE_CAPACITY);
+    PdfDocument(PdfDocument &&other) noexcept;
+    PdfDocument& operator=(PdfDocument &&other) noexcept;
+    ~PdfDocument();
+    size_t get_pages_count() const;
+    std::string get_page_text(size_t page_num);
+    std::string get_text(unsigned int threads_num = 1);
+    //text is passed to sink as soon as page and all previous pages are extracted
+    void extract_pages(const page_sink_t &sink, unsigned int threads_num = 1);
+    //size of streams which weren`t decoded because they can`t contain text(images, ICC profiles etc)
+    size_t get_skipped_bytes() const;
+    //lookups of parsed objects, misses much bigger than capacity mean that cache is too small
+    size_t get_cache_hits() const;
+    size_t get_cache_misses() const;
+private:
+    struct Impl;
+    explicit PdfDocument(std::unique_ptr<Impl> &&impl_arg);
+private:
+    std::unique_ptr<Impl> impl;
+};
 
 #endif //PDF_EXTRACTOR
@@ -0,0 +1,289 @@
+#include <string>
+#include <cstring>
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "predictor.h"
+
+using namespace std;
+
+namespace
+{
+    enum
+    {
+        NO_PREDICTION = 1,
+        TIFF_PREDICTOR = 2,
+        PNG_NONE = 10,
+        PNG_SUB = 11,
+        PNG_UP = 12,
+        PNG_AVERAGE = 13,
+        PNG_PAETH = 14,
+        PNG_OPTIMUM = 15
+    };
+
+    unsigned int get_decode_key(const dict_t &opts, const string &key, unsigned int def)
+    {
+        auto it = opts.find(key);
+        if (it == opts.end()) return def;
+
+        return strict_stoul(it->second.first);
+    }
+
+    //row kernels. row and encoded can overlap only when row is not located after encoded
+    void sub_row(unsigned char *row, const unsigned char *encoded, size_t len, size_t bpp)
+    {
+        if (bpp == 1)
+        {
+            //left byte is kept in register instead of reading back just written one
+            unsigned char left = 0;
+            for (size_t i = 0; i < len; ++i) row[i] = left = encoded[i] + left;
+            return;
+        }
+        size_t i = 0;
+        for (; i < bpp && i < len; ++i) row[i] = encoded[i];
+        for (; i < len; ++i) row[i] = encoded[i] + row[i - bpp];
+    }
+
+    void up_row(unsigned char *row, const unsigned char *encoded, const unsigned char *up, size_t len)
+    {
+        size_t i = 0;
+#ifdef __SSE2__
+        //16 bytes of encoded are loaded before they can be overwritten by row store
+        for (; i + 16 <= len; i += 16)
+        {
+            __m128i e = _mm_loadu_si128(reinterpret_cast<const __m128i*>(encoded + i));
+            __m128i u = _mm_loadu_si128(reinterpret_cast<const __m128i*>(up + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(row + i), _mm_add_epi8(e, u));
+        }
+#endif
+        for (; i < len; ++i) row[i] = encoded[i] + up[i];
+    }
+
+    void average_row(unsigned char *row, const unsigned char *encoded, const unsigned char *up, size_t len, size_t bpp)
+    {
+        if (bpp == 1 && up)
+        {
+            unsigned int left = 0;
+            for (size_t i = 0; i < len; ++i) row[i] = left = static_cast<unsigned char>(encoded[i] + ((left + up[i]) >> 1));
+            return;
+        }
+        for (size_t i = 0; i < len; ++i)
+        {
+            unsigned int left = (i < bpp)? 0 : row[i - bpp];
+            unsigned int above = up? up[i] : 0;
+            row[i] = encoded[i] + ((left + above) >> 1);
+        }
+    }
+
+    //distances to p = left + above - upper_left are written without p, so compiler emits conditional moves
+    unsigned char paeth(int left, int above, int upper_left)
+    {
+        int pa = abs(above - upper_left);
+        int pb = abs(left - upper_left);
+        int pc = abs(left + above - 2 * upper_left);
+        int result = (pb <= pc)? above : upper_left;
+        return (pa <= pb && pa <= pc)? left : result;
+    }
+
+    void paeth_row(unsigned char *row, const unsigned char *encoded, const unsigned char *up, size_t len, size_t bpp)
+    {
+        if (bpp == 1)
+        {
+            int left = 0;
+            int upper_left = 0;
+            for (size_t i = 0; i < len; ++i)
+            {
+                int above = up[i];
+                row[i] = left = static_cast<unsigned char>(encoded[i] + paeth(left, above, upper_left));
+                upper_left = above;
+            }
+            return;
+        }
+        size_t i = 0;
+        //left and upper left pixels are zeros, so predictor is the above pixel
+        for (; i < bpp && i < len; ++i) row[i] = encoded[i] + up[i];
+        for (; i < len; ++i) row[i] = encoded[i] + paeth(row[i - bpp], up[i], up[i - bpp]);
+    }
+
+    class PredictorStage : public FilterStage
+    {
+    public:
+        PredictorStage(unique_ptr<FilterStage> &&source_arg, const Predictor &predictor_arg) :
+                       source(std::move(source_arg)), predictor(predictor_arg), decoded_end(0)
+        {
+        }
+
+        //buffer: [decoded rows][tail of incomplete row]
+        boost::string_view read() override
+        {
+            //chunk returned by the previous call is not needed anymore, only its last row is kept for the next rows
+            size_t prev_row_len = min(decoded_end, predictor.get_row_length());
+            buffer.erase(0, decoded_end - prev_row_len);
+            decoded_end = prev_row_len;
+            while (decoded_end == prev_row_len)
+            {
+                boost::string_view chunk = source->read();
+                //incomplete last row is dropped
+                if (chunk.empty()) return boost::string_view();
+                buffer.append(chunk.data(), chunk.length());
+                size_t offset = predictor.decode_rows(&buffer[0], decoded_end, buffer.length(), decoded_end);
+                buffer.erase(decoded_end, offset - decoded_end);
+            }
+            return boost::string_view(buffer.data() + prev_row_len, decoded_end - prev_row_len);
+        }
+    private:
+        unique_ptr<FilterStage> source;
+        Predictor predictor;
+        string buffer;
+        size_t decoded_end;
+    };
+}
+
+Predictor::Predictor(const dict_t &opts) : predictor(get_decode_key(opts, "/Predictor", NO_PREDICTION)),
+                                           colors(get_decode_key(opts, "/Colors", 1)),
+                                           BPCs(get_decode_key(opts, "/BitsPerComponent", 8)),
+                                           columns(get_decode_key(opts, "/Columns", 1)),
+                                           first_row(true)
+{
+    //PNG: bpp is rounded up to one byte for less than 8 bits per pixel
+    bpp = max<size_t>((BPCs * colors) >> 3, 1);
+    row_len = (static_cast<size_t>(columns) * colors * BPCs + 7) >> 3;
+
+    if (predictor == NO_PREDICTION) return;
+    if (BPCs != 1 && BPCs != 2 && BPCs != 4 && BPCs != 8 && BPCs != 16)
+    {
+        throw pdf_error(FUNC_STRING + "BitsPerComponent " + to_string(BPCs) + " is invalid");
+    }
+    if (predictor != TIFF_PREDICTOR && (predictor < PNG_NONE || predictor > PNG_OPTIMUM))
+    {
+        throw pdf_error(FUNC_STRING + "predictor " + to_string(predictor) + " is invalid");
+    }
+}
+
+bool Predictor::is_identity() const
+{
+    return predictor == NO_PREDICTION || row_len == 0;
+}
+
+size_t Predictor::get_row_length() const
+{
+    return row_len;
+}
+
+size_t Predictor::decode_rows(char *buffer, size_t offset, size_t end, size_t &decoded_end)
+{
+    if (is_identity())
+    {
+        memmove(buffer + decoded_end, buffer + offset, end - offset);
+        decoded_end += end - offset;
+        return end;
+    }
+    //PNG rows start with the byte of row predictor
+    size_t tag_len = (predictor == TIFF_PREDICTOR)? 0 : 1;
+    unsigned char *data = reinterpret_cast<unsigned char*>(buffer);
+    for (; end - offset >= row_len + tag_len; offset += row_len + tag_len)
+    {
+        unsigned int row_predictor = tag_len? data[offset] + PNG_NONE : TIFF_PREDICTOR;
+        decode_row(data + decoded_end, data + offset + tag_len, row_predictor);
+        decoded_end += row_len;
+        first_row = false;
+    }
+    return offset;
+}
+
+//encoded can be located after row or be the same, so every byte is read before the same position of row is written
+void Predictor::decode_row(unsigned char *row, const unsigned char *encoded, unsigned int row_predictor)
+{
+    //missing previous row and pixels before the row start are zeros
+    const unsigned char *up = first_row? nullptr : row - row_len;
+    switch (row_predictor)
+    {
+    case PNG_NONE:
+        memmove(row, encoded, row_len);
+        break;
+    case PNG_SUB:
+        sub_row(row, encoded, row_len, bpp);
+        break;
+    case PNG_UP:
+        if (up) up_row(row, encoded, up, row_len);
+        else memmove(row, encoded, row_len);
+        break;
+    case PNG_AVERAGE:
+        average_row(row, encoded, up, row_len, bpp);
+        break;
+    case PNG_PAETH:
+        //without previous row Paeth predictor is always the left pixel
+        if (up) paeth_row(row, encoded, up, row_len, bpp);
+        else sub_row(row, encoded, row_len, bpp);
+        break;
+    case TIFF_PREDICTOR:
+        decode_tiff_row(row, encoded);
+        break;
+    default:
+        throw pdf_error(FUNC_STRING + "predictor " + to_string(row_predictor) + " is invalid");
+    }
+}
+
+//TIFF predictor works with components instead of bytes, components of the same color are subtracted
+void Predictor::decode_tiff_row(unsigned char *row, const unsigned char *encoded)
+{
+    if (row != encoded) memmove(row, encoded, row_len);
+    switch (BPCs)
+    {
+    case 8:
+        sub_row(row, row, row_len, colors);
+        break;
+    case 16:
+        for (size_t i = 2 * colors; i + 1 < row_len; i += 2)
+        {
+            unsigned int value = ((row[i] << 8) | row[i + 1]) + ((row[i - 2 * colors] << 8) | row[i + 1 - 2 * colors]);
+            row[i] = static_cast<unsigned char>(value >> 8);
+            row[i + 1] = static_cast<unsigned char>(value);
+        }
+        break;
+    default:
+    {
+        //1, 2 and 4 bits per component: components are packed from the high bits of every byte
+        const unsigned int mask = (1u << BPCs) - 1;
+        const size_t components = static_cast<size_t>(columns) * colors;
+        for (size_t i = colors; i < components; ++i)
+        {
+            size_t bit = i * BPCs;
+            size_t left_bit = (i - colors) * BPCs;
+            unsigned int shift = 8 - BPCs - bit % 8;
+            unsigned int left = (row[left_bit / 8] >> (8 - BPCs - left_bit % 8)) & mask;
+            unsigned int value = (((row[bit / 8] >> shift) & mask) + left) & mask;
+            row[bit / 8] = (row[bit / 8] & ~(mask << shift)) | (value << shift);
+        }
+        break;
+    }
+    }
+}
+
+string predictor_decode(const string &data, const dict_t &opts)
+{
+    return predictor_decode(string(data), opts);
+}
+
+string predictor_decode(string &&data, const dict_t &opts)
+{
+    Predictor predictor(opts);
+    if (predictor.is_identity()) return std::move(data);
+    size_t decoded_end = 0;
+    predictor.decode_rows(&data[0], 0, data.length(), decoded_end);
+    data.resize(decoded_end);
+    return std::move(data);
+}
+
+unique_ptr<FilterStage> make_predictor_stage(unique_ptr<FilterStage> &&source, const dict_t &opts)
+{
+    Predictor predictor(opts);
+    if (predictor.is_identity()) return std::move(source);
+    return unique_ptr<FilterStage>(new PredictorStage(std::move(source), predictor));
+}
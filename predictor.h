@@ -0,0 +1,39 @@
+#ifndef PREDICTOR_H
+#define PREDICTOR_H
+
+#include <string>
+#include <memory>
+
+#include "common.h"
+#include "filter_chain.h"
+
+//7.4.4.4. LZW and Flate Predictor Functions
+//rows are decoded in place: decoded row is never longer than encoded one, so it overwrites already consumed input
+class Predictor
+{
+public:
+    explicit Predictor(const dict_t &opts);
+    bool is_identity() const;
+    size_t get_row_length() const;
+    //decodes complete rows of buffer[offset, end) and writes them from decoded_end (decoded_end <= offset).
+    //previous decoded row must be right before decoded_end. Returns offset of the first not decoded byte
+    size_t decode_rows(char *buffer, size_t offset, size_t end, size_t &decoded_end);
+private:
+    void decode_row(unsigned char *row, const unsigned char *encoded, unsigned int row_predictor);
+    void decode_tiff_row(unsigned char *row, const unsigned char *encoded);
+private:
+    unsigned int predictor;
+    unsigned int colors;
+    unsigned int BPCs;
+    unsigned int columns;
+    size_t bpp;
+    size_t row_len;
+    bool first_row;
+};
+
+std::string predictor_decode(const std::string &data, const dict_t &opts);
+std::string predictor_decode(std::string &&data, const dict_t &opts);
+//returns source itself if opts have no predictor
+std::unique_ptr<FilterStage> make_predictor_stage(std::unique_ptr<FilterStage> &&source, const dict_t &opts);
+
+#endif //PREDICTOR_H
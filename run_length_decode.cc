@@ -0,0 +1,118 @@
+#include <string>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <cstring>
+
+#include "common.h"
+#include "filter_chain.h"
+
+using namespace std;
+
+//7.4.5. RunLengthDecode Filter
+namespace
+{
+    enum { RL_EOD = 128, MAX_RUN_LEN = 128 };
+
+    class RunLengthDecoder
+    {
+    public:
+        RunLengthDecoder() : literal_len(0), repeat_len(0), finished(false)
+        {
+        }
+
+        //appends decoded data to result, data after EOD is ignored.
+        //Runs can be split between calls, so the rest of the current run is kept in literal_len or repeat_len
+        void decode(boost::string_view data, string &result)
+        {
+            //result is grown in advance and cut to decoded data at the end
+            size_t end = result.length();
+            size_t i = 0;
+            while (i < data.length() && !finished)
+            {
+                if (end + MAX_RUN_LEN > result.length())
+                {
+                    result.resize(max(result.length() * 2, end + MAX_RUN_LEN + data.length() * 2));
+                }
+                if (literal_len > 0)
+                {
+                    size_t len = min<size_t>(literal_len, data.length() - i);
+                    memcpy(&result[end], data.data() + i, len);
+                    end += len;
+                    i += len;
+                    literal_len -= len;
+                    continue;
+                }
+                unsigned char c = data[i++];
+                if (repeat_len > 0)
+                {
+                    memset(&result[end], c, repeat_len);
+                    end += repeat_len;
+                    repeat_len = 0;
+                }
+                else if (c < RL_EOD)
+                {
+                    literal_len = c + 1;
+                }
+                else if (c == RL_EOD)
+                {
+                    finished = true;
+                }
+                else
+                {
+                    repeat_len = 257 - c;
+                }
+            }
+            result.resize(end);
+        }
+
+        bool is_finished() const
+        {
+            return finished;
+        }
+    private:
+        unsigned int literal_len;
+        unsigned int repeat_len;
+        bool finished;
+    };
+
+    class RunLengthStage : public FilterStage
+    {
+    public:
+        explicit RunLengthStage(unique_ptr<FilterStage> &&source_arg) : source(std::move(source_arg))
+        {
+        }
+
+        boost::string_view read() override
+        {
+            output.clear();
+            while (output.empty() && !decoder.is_finished())
+            {
+                if (input.empty()) input = source->read();
+                if (input.empty()) break;
+                size_t len = min<size_t>(input.length(), FILTER_CHUNK_SIZE);
+                decoder.decode(input.substr(0, len), output);
+                input.remove_prefix(len);
+            }
+            return output;
+        }
+    private:
+        unique_ptr<FilterStage> source;
+        boost::string_view input;
+        RunLengthDecoder decoder;
+        string output;
+    };
+}
+
+string run_length_decode(const string &buf, const dict_t &opts)
+{
+    RunLengthDecoder decoder;
+    string result;
+    decoder.decode(buf, result);
+    return result;
+}
+
+unique_ptr<FilterStage> make_run_length_stage(unique_ptr<FilterStage> &&source, const dict_t &opts)
+{
+    return unique_ptr<FilterStage>(new RunLengthStage(std::move(source)));
+}
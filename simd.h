@@ -0,0 +1,18 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+//SSE2 is part of x86-64, so its kernels are selected at compile time.
+//AVX2 kernels are compiled with target attribute and selected at runtime by cpu_has_avx2()
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && defined(__SSE2__)
+#define PDF_EXTRACTOR_X86_SIMD 1
+#include <immintrin.h>
+#define TARGET_AVX2 __attribute__((target("avx2")))
+
+inline bool cpu_has_avx2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+#endif
+
+#endif //SIMD_H